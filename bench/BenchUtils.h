@@ -0,0 +1,38 @@
+#ifndef BENCHUTILS_H
+#define BENCHUTILS_H
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+template <typename Func>
+double measureSeconds(Func&& func)
+{
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(finish - start).count();
+}
+
+template <typename T>
+void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    // Portable fallback: publishing the address through a volatile keeps the value observable.
+    static const void* volatile sink;
+    sink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+inline void printRow(const std::string& name, double value, const std::string& unit)
+{
+    std::cout << std::left << std::setw(48) << name << std::right << std::setw(16)
+              << std::fixed << std::setprecision(2) << value << ' ' << unit << std::endl;
+}
+
+#endif //BENCHUTILS_H
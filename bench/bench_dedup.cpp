@@ -0,0 +1,88 @@
+#include "BenchUtils.h"
+#include "FigureDedup.h"
+#include "Parallel.h"
+#include "Rectangle.h"
+#include <array>
+#include <random>
+#include <vector>
+
+// Quads drawn from a small pool of distinct rectangles, each copy with a random starting vertex and winding.
+static std::vector<std::array<Point<double>, 4>> makeQuads(size_t amount, size_t amountOfDistinct)
+{
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+    std::vector<std::array<Point<double>, 4>> pool;
+    for (size_t i = 0; i < amountOfDistinct; ++i)
+    {
+        double x = coordinate(generator);
+        double y = coordinate(generator);
+        double w = std::abs(coordinate(generator)) + 1;
+        double h = std::abs(coordinate(generator)) + 1;
+        pool.push_back({Point<double>(x, y), Point<double>(x + w, y), Point<double>(x + w, y + h), Point<double>(x, y + h)});
+    }
+
+    std::uniform_int_distribution<size_t> pick(0, amountOfDistinct - 1);
+    std::uniform_int_distribution<size_t> shift(0, 3);
+    std::vector<std::array<Point<double>, 4>> quads;
+    quads.reserve(amount);
+    for (size_t i = 0; i < amount; ++i)
+    {
+        const auto& ring = pool[pick(generator)];
+        size_t s = shift(generator);
+        bool reversed = generator() % 2 == 0;
+        std::array<Point<double>, 4> quad;
+        for (size_t k = 0; k < 4; ++k)
+        {
+            quad[k] = ring[reversed ? (s + 4 - k) % 4 : (s + k) % 4];
+        }
+        quads.push_back(quad);
+    }
+    return quads;
+}
+
+int main()
+{
+    constexpr size_t amount = 1'000'000;
+    for (size_t amountOfDistinct : {1'000, 10'000, 30'000, 100'000})
+    {
+        auto quads = makeQuads(amount, amountOfDistinct);
+        std::string name = std::to_string(amountOfDistinct) + " distinct";
+
+        // Baseline: every copy is materialized and stored, and its metrics computed.
+        double recomputeSeconds = measureSeconds([&] {
+            std::vector<Rectangle<double>> figures(quads.size());
+            parallelFor(quads.size(), 4096, [&](size_t begin, size_t end, size_t) {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    figures[i].setVertices(quads[i]);
+                }
+            });
+            double sum = 0;
+            for (const auto& figure : figures)
+            {
+                sum += static_cast<double>(figure) + figure.calcGeometricCenter().x;
+            }
+            doNotOptimize(sum);
+        });
+
+        DedupTable<Rectangle<double>> table;
+        double internSeconds = measureSeconds([&] {
+            auto entries = table.internAll(quads);
+            double sum = 0;
+            for (const auto* entry : entries)
+            {
+                sum += entry->area + entry->center.x;
+            }
+            doNotOptimize(sum);
+        });
+
+        DedupStats stats = table.stats();
+        printRow(name + " recompute", static_cast<double>(amount) / recomputeSeconds / 1e6, "Mfigures/s");
+        printRow(name + " intern + lookup", static_cast<double>(amount) / internSeconds / 1e6, "Mfigures/s");
+        printRow(name + " dedup ratio", stats.ratio(), "x");
+        printRow(name + " copies avoided", static_cast<double>(stats.bytesSaved) / (1024.0 * 1024.0), "MiB");
+        printRow(name + " table footprint", static_cast<double>(stats.tableBytes) / (1024.0 * 1024.0), "MiB");
+        printRow(name + " net memory saved", static_cast<double>(stats.netBytesSaved()) / (1024.0 * 1024.0), "MiB");
+    }
+    return 0;
+}
@@ -0,0 +1,200 @@
+#include "BenchUtils.h"
+#include "Rectangle.h"
+#include "SpatialOrder.h"
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+// Hardware cache-miss counter for the calling thread; unavailable in most containers.
+class CacheMissCounter {
+private:
+    int fd_ = -1;
+public:
+    CacheMissCounter()
+    {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+    ~CacheMissCounter()
+    {
+        if (fd_ != -1)
+        {
+            close(fd_);
+        }
+    }
+    CacheMissCounter(const CacheMissCounter&) = delete;
+    CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+public:
+    template <typename Func>
+    std::optional<uint64_t> measure(Func&& func)
+    {
+        if (fd_ == -1)
+        {
+            func();
+            return std::nullopt;
+        }
+        ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+        func();
+        ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+        uint64_t count = 0;
+        if (read(fd_, &count, sizeof(count)) != sizeof(count))
+        {
+            return std::nullopt;
+        }
+        return count;
+    }
+};
+#else
+// Hardware counters are only read through perf_event_open; elsewhere misses are reported as n/a.
+class CacheMissCounter {
+public:
+    template <typename Func>
+    std::optional<uint64_t> measure(Func&& func)
+    {
+        func();
+        return std::nullopt;
+    }
+};
+#endif
+
+static constexpr size_t side = 700;
+
+// Each figure sits in one cell of a jittered grid; its neighbours are the figures of the eight adjacent cells.
+struct Layout {
+    std::vector<Rectangle<double>> rectangles;
+    std::vector<std::vector<size_t>> neighbours;
+};
+
+static Layout makeShuffledLayout()
+{
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> jitter(0.0, 0.5);
+    std::vector<size_t> cellOf(side * side);
+    for (size_t i = 0; i < cellOf.size(); ++i)
+    {
+        cellOf[i] = i;
+    }
+    std::shuffle(cellOf.begin(), cellOf.end(), generator);
+
+    Layout layout;
+    std::vector<size_t> figureAt(cellOf.size());
+    for (size_t figure = 0; figure < cellOf.size(); ++figure)
+    {
+        double x = static_cast<double>(cellOf[figure] % side) + jitter(generator);
+        double y = static_cast<double>(cellOf[figure] / side) + jitter(generator);
+        layout.rectangles.push_back(Rectangle<double>({{x, y}, {x + 0.5, y}, {x + 0.5, y + 0.5}, {x, y + 0.5}}));
+        figureAt[cellOf[figure]] = figure;
+    }
+
+    layout.neighbours.resize(cellOf.size());
+    for (size_t figure = 0; figure < cellOf.size(); ++figure)
+    {
+        size_t cx = cellOf[figure] % side;
+        size_t cy = cellOf[figure] / side;
+        for (size_t y = cy == 0 ? 0 : cy - 1; y <= std::min(cy + 1, side - 1); ++y)
+        {
+            for (size_t x = cx == 0 ? 0 : cx - 1; x <= std::min(cx + 1, side - 1); ++x)
+            {
+                if (x != cx || y != cy)
+                {
+                    layout.neighbours[figure].push_back(figureAt[y * side + x]);
+                }
+            }
+        }
+    }
+    return layout;
+}
+
+// Reorders the figures and their neighbour lists together, remapping neighbour indices to the new positions.
+static Layout reorder(const Layout& layout, SpaceFillingCurve curve)
+{
+    Layout result = layout;
+    SpatialOrder order(result.rectangles, curve);
+    std::vector<size_t> positionOf(order.order().size());
+    for (size_t position = 0; position < positionOf.size(); ++position)
+    {
+        positionOf[order.order()[position]] = position;
+    }
+    order.apply(result.rectangles, result.neighbours);
+    for (auto& list : result.neighbours)
+    {
+        for (size_t& neighbour : list)
+        {
+            neighbour = positionOf[neighbour];
+        }
+    }
+    return result;
+}
+
+static double neighbourAreaSum(const Layout& layout)
+{
+    double sum = 0;
+    for (size_t figure = 0; figure < layout.rectangles.size(); ++figure)
+    {
+        for (size_t neighbour : layout.neighbours[figure])
+        {
+            sum += static_cast<double>(layout.rectangles[neighbour]);
+        }
+    }
+    return sum;
+}
+
+static void runWorkload(const std::string& name, const Layout& layout, CacheMissCounter& counter)
+{
+    constexpr size_t repetitions = 5;
+    neighbourAreaSum(layout);
+
+    std::optional<uint64_t> misses;
+    double seconds = measureSeconds([&] {
+        misses = counter.measure([&] {
+            for (size_t i = 0; i < repetitions; ++i)
+            {
+                doNotOptimize(neighbourAreaSum(layout));
+            }
+        });
+    });
+    printRow(name + " neighbour queries", static_cast<double>(layout.rectangles.size() * repetitions) / seconds / 1e6, "Mfigures/s");
+    if (misses)
+    {
+        printRow(name + " cache misses per figure", static_cast<double>(*misses) / static_cast<double>(layout.rectangles.size() * repetitions), "");
+    }
+    else
+    {
+        std::cout << std::left << std::setw(48) << name + " cache misses per figure" << std::right << std::setw(16) << "n/a" << std::endl;
+    }
+}
+
+int main()
+{
+    Layout arbitrary = makeShuffledLayout();
+    CacheMissCounter counter;
+
+    double seconds = measureSeconds([&] {
+        doNotOptimize(SpatialOrder(arbitrary.rectangles, SpaceFillingCurve::Hilbert).keys().size());
+    });
+    printRow("hilbert keys + sort", static_cast<double>(arbitrary.rectangles.size()) / seconds / 1e6, "Mfigures/s");
+
+    runWorkload("arbitrary order", arbitrary, counter);
+    runWorkload("morton order", reorder(arbitrary, SpaceFillingCurve::Morton), counter);
+    runWorkload("hilbert order", reorder(arbitrary, SpaceFillingCurve::Hilbert), counter);
+    return 0;
+}
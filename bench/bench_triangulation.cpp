@@ -0,0 +1,84 @@
+#include "BenchUtils.h"
+#include "PolygonTriangulation.h"
+#include "Rectangle.h"
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <numbers>
+#include <random>
+#include <vector>
+
+static std::atomic<size_t> allocations = 0;
+
+void* operator new(size_t size)
+{
+    ++allocations;
+    if (void* ptr = std::malloc(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+static std::vector<Point<double>> makeStar(size_t amountOfVertices)
+{
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> radius(1.0, 10.0);
+    std::vector<Point<double>> points;
+    for (size_t i = 0; i < amountOfVertices; ++i)
+    {
+        double angle = 2 * std::numbers::pi * static_cast<double>(i) / static_cast<double>(amountOfVertices);
+        double r = radius(generator);
+        points.emplace_back(r * std::cos(angle), r * std::sin(angle));
+    }
+    return points;
+}
+
+int main()
+{
+    Triangulator<double> triangulator;
+    for (size_t amountOfVertices : {1'000, 10'000, 100'000, 1'000'000})
+    {
+        auto points = makeStar(amountOfVertices);
+        std::vector<uint32_t> indices(Triangulator<double>::indexCount(points.size()));
+        triangulator.triangulate(points, indices);
+
+        size_t repetitions = std::max<size_t>(1, 2'000'000 / amountOfVertices);
+        size_t before = allocations;
+        double seconds = measureSeconds([&] {
+            for (size_t i = 0; i < repetitions; ++i)
+            {
+                doNotOptimize(triangulator.triangulate(points, indices));
+            }
+        });
+        size_t warmAllocations = allocations - before;
+        std::string name = "star n=" + std::to_string(amountOfVertices);
+        printRow(name + " throughput", static_cast<double>(amountOfVertices * repetitions) / seconds / 1e6, "Mvertices/s");
+        printRow(name + " allocations per warm call", static_cast<double>(warmAllocations) / static_cast<double>(repetitions), "");
+    }
+
+    std::vector<Rectangle<double>> rectangles;
+    for (size_t i = 0; i < 1'000'000; ++i)
+    {
+        double x = static_cast<double>(i % 1000);
+        double y = static_cast<double>(i / 1000);
+        rectangles.push_back(Rectangle<double>({{x, y}, {x + 1, y}, {x + 1, y + 0.5}, {x, y + 0.5}}));
+    }
+    std::vector<uint32_t> indices(rectangles.size() * Triangulator<double>::indexCount(4));
+    double seconds = measureSeconds([&] {
+        doNotOptimize(triangulator.triangulateAll(rectangles, indices));
+    });
+    printRow("batch 1M rectangles", static_cast<double>(rectangles.size()) / seconds / 1e6, "Mfigures/s");
+    return 0;
+}
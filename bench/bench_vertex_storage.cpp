@@ -0,0 +1,115 @@
+#include "BenchUtils.h"
+#include "Polygon.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+// Live heap bytes and blocks; every block carries its size in a header so frees are accounted too.
+static std::atomic<size_t> liveBytes = 0;
+static std::atomic<size_t> liveBlocks = 0;
+constexpr size_t headerSize = alignof(std::max_align_t);
+
+void* operator new(size_t size)
+{
+    auto* block = static_cast<unsigned char*>(std::malloc(size + headerSize));
+    if (!block)
+    {
+        throw std::bad_alloc();
+    }
+    *reinterpret_cast<size_t*>(block) = size;
+    liveBytes += size;
+    ++liveBlocks;
+    return block + headerSize;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if (!ptr)
+    {
+        return;
+    }
+    auto* block = static_cast<unsigned char*>(ptr) - headerSize;
+    liveBytes -= *reinterpret_cast<size_t*>(block);
+    --liveBlocks;
+    std::free(block);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+// The vertex layout Polygon used before the inline store: one heap node per vertex.
+template <Scalar T>
+class LegacyPolygon : public Figure<T> {
+private:
+    std::vector<std::unique_ptr<Point<T>>> vertices_;
+public:
+    explicit LegacyPolygon(const std::vector<Point<T>>& points) : vertices_(points.size())
+    {
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            vertices_[i] = std::make_unique<Point<T>>(points[i].x, points[i].y);
+        }
+    }
+public:
+    Point<T> calcGeometricCenter() const override
+    {
+        return Point<T>();
+    }
+public:
+    explicit operator double() const override
+    {
+        return static_cast<double>(vertices_.size());
+    }
+};
+
+static std::vector<Point<double>> makeRing(size_t amountOfVertices)
+{
+    std::vector<Point<double>> points;
+    for (size_t i = 0; i < amountOfVertices; ++i)
+    {
+        points.emplace_back(static_cast<double>(i), static_cast<double>(i * i % 7));
+    }
+    return points;
+}
+
+template <typename PolygonType>
+void benchLayout(const std::string& name, size_t amountOfVertices, size_t amountOfPolygons)
+{
+    const auto points = makeRing(amountOfVertices);
+    std::vector<PolygonType> polygons;
+    polygons.reserve(amountOfPolygons);
+
+    size_t before = liveBytes;
+    size_t blocksBefore = liveBlocks;
+    double seconds = measureSeconds([&] {
+        for (size_t i = 0; i < amountOfPolygons; ++i)
+        {
+            polygons.emplace_back(points);
+        }
+    });
+    size_t heapBytes = liveBytes - before;
+    size_t heapBlocks = liveBlocks - blocksBefore;
+    doNotOptimize(polygons.data());
+
+    double bytesPerPolygon = sizeof(PolygonType) + static_cast<double>(heapBytes) / static_cast<double>(amountOfPolygons);
+    printRow(name + " n=" + std::to_string(amountOfVertices) + " footprint", bytesPerPolygon, "B/polygon");
+    printRow(name + " n=" + std::to_string(amountOfVertices) + " heap blocks", static_cast<double>(heapBlocks) / static_cast<double>(amountOfPolygons), "per polygon");
+    printRow(name + " n=" + std::to_string(amountOfVertices) + " construction", amountOfPolygons / seconds / 1e6, "Mpolygons/s");
+}
+
+int main()
+{
+    constexpr size_t amountOfPolygons = 1'000'000;
+    for (size_t amountOfVertices : {3, 4, 6, 8, 32})
+    {
+        benchLayout<LegacyPolygon<double>>("legacy unique_ptr", amountOfVertices, amountOfPolygons);
+        benchLayout<Polygon<double, 4>>("inline<4>", amountOfVertices, amountOfPolygons);
+        benchLayout<Polygon<double>>("inline<8>", amountOfVertices, amountOfPolygons);
+    }
+    return 0;
+}
@@ -0,0 +1,731 @@
+#ifndef FIGUREDEDUP_H
+#define FIGUREDEDUP_H
+
+#include "FigureTraits.h"
+#include "Parallel.h"
+#include "Polygon.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <ranges>
+#include <shared_mutex>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// Figures that differ only by starting vertex or winding share one canonical form: the vertex
+// ring read from a lexicographically smallest (x, y) vertex, in whichever direction and from
+// whichever such vertex gives the smallest sequence. -0.0 compares and hashes like 0.0.
+
+struct CanonicalOrder {
+    size_t start;
+    bool reversed;
+};
+
+template <Scalar T>
+CanonicalOrder canonicalOrder(std::span<const Point<T>> vertices);
+
+template <Scalar T>
+Point<T> canonicalVertex(std::span<const Point<T>> vertices, CanonicalOrder order, size_t index);
+
+template <Scalar T>
+std::vector<Point<T>> canonicalVertices(std::span<const Point<T>> vertices);
+
+template <Scalar T>
+uint64_t canonicalHash(std::span<const Point<T>> vertices, CanonicalOrder order);
+
+template <Scalar T>
+uint64_t canonicalHash(std::span<const Point<T>> vertices);
+
+namespace detail {
+
+template <Scalar T>
+bool lexicographicallyLess(const Point<T>& lhs, const Point<T>& rhs)
+{
+    return lhs.x < rhs.x || (lhs.x == rhs.x && lhs.y < rhs.y);
+}
+
+// Three-way comparison of two rings, each read in its own canonical order.
+template <Scalar T>
+int compareCanonical(std::span<const Point<T>> lhs, CanonicalOrder lhsOrder,
+                     std::span<const Point<T>> rhs, CanonicalOrder rhsOrder)
+{
+    const size_t size = std::min(lhs.size(), rhs.size());
+    for (size_t i = 0; i < size; ++i)
+    {
+        Point<T> a = canonicalVertex(lhs, lhsOrder, i);
+        Point<T> b = canonicalVertex(rhs, rhsOrder, i);
+        if (lexicographicallyLess(a, b))
+        {
+            return -1;
+        }
+        if (lexicographicallyLess(b, a))
+        {
+            return 1;
+        }
+    }
+    return lhs.size() < rhs.size() ? -1 : lhs.size() > rhs.size() ? 1 : 0;
+}
+
+template <Scalar T>
+bool equalCanonical(std::span<const Point<T>> lhs, CanonicalOrder lhsOrder,
+                    std::span<const Point<T>> rhs, CanonicalOrder rhsOrder)
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        Point<T> a = canonicalVertex(lhs, lhsOrder, i);
+        Point<T> b = canonicalVertex(rhs, rhsOrder, i);
+        if (a.x != b.x || a.y != b.y)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <Scalar T>
+uint64_t coordinateBits(T value)
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return std::bit_cast<uint64_t>(static_cast<double>(value) + 0.0);
+    }
+    else
+    {
+        return static_cast<uint64_t>(value);
+    }
+}
+
+constexpr uint64_t hashPrime1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t hashPrime2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t hashPrime3 = 0x165667B19E3779F9ull;
+
+inline uint64_t hashRound(uint64_t lane, uint64_t input)
+{
+    return std::rotl(lane + input * hashPrime2, 31) * hashPrime1;
+}
+
+template <typename F>
+F makeFigure(std::span<const Point<FigureScalar<F>>> vertices)
+{
+    using T = FigureScalar<F>;
+    if constexpr (std::is_constructible_v<F, std::vector<Point<T>>>)
+    {
+        return F(std::vector<Point<T>>(vertices.begin(), vertices.end()));
+    }
+    else
+    {
+        // One bulk assignment, so the metrics match what the constructors compute.
+        F figure;
+        figure.setVertices(vertices);
+        return figure;
+    }
+}
+
+template <Scalar T, size_t N>
+constexpr size_t inlineCapacityOf(const Polygon<T, N>*)
+{
+    return N;
+}
+
+} // namespace detail
+
+template <Scalar T>
+CanonicalOrder canonicalOrder(std::span<const Point<T>> vertices)
+{
+    const size_t size = vertices.size();
+    CanonicalOrder best{0, false};
+    size_t smallest = 0;
+    size_t amountOfSmallest = 1;
+    for (size_t i = 1; i < size; ++i)
+    {
+        if (detail::lexicographicallyLess(vertices[i], vertices[smallest]))
+        {
+            smallest = i;
+            amountOfSmallest = 1;
+        }
+        else if (!detail::lexicographicallyLess(vertices[smallest], vertices[i]))
+        {
+            ++amountOfSmallest;
+        }
+    }
+
+    // With a unique smallest vertex the direction is decided by its two neighbours, unless they tie.
+    if (amountOfSmallest == 1 && size > 2)
+    {
+        const Point<T>& next = vertices[smallest + 1 == size ? 0 : smallest + 1];
+        const Point<T>& prev = vertices[smallest == 0 ? size - 1 : smallest - 1];
+        if (detail::lexicographicallyLess(next, prev) || detail::lexicographicallyLess(prev, next))
+        {
+            return {smallest, detail::lexicographicallyLess(prev, next)};
+        }
+    }
+
+    bool found = false;
+    for (size_t start = 0; start < size; ++start)
+    {
+        if (detail::lexicographicallyLess(vertices[smallest], vertices[start]))
+        {
+            continue;
+        }
+        for (bool reversed : {false, true})
+        {
+            CanonicalOrder candidate{start, reversed};
+            if (!found || detail::compareCanonical(vertices, candidate, vertices, best) < 0)
+            {
+                best = candidate;
+                found = true;
+            }
+        }
+    }
+    return best;
+}
+
+template <Scalar T>
+Point<T> canonicalVertex(std::span<const Point<T>> vertices, CanonicalOrder order, size_t index)
+{
+    // index < size, so the ring wraps at most once and a conditional step replaces the division.
+    const size_t size = vertices.size();
+    size_t position = order.reversed ? order.start + size - index : order.start + index;
+    position -= position >= size ? size : 0;
+    const Point<T>& point = vertices[position];
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return Point<T>(point.x + T(0), point.y + T(0));
+    }
+    else
+    {
+        return point;
+    }
+}
+
+template <Scalar T>
+std::vector<Point<T>> canonicalVertices(std::span<const Point<T>> vertices)
+{
+    CanonicalOrder order = canonicalOrder(vertices);
+    std::vector<Point<T>> result;
+    result.reserve(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        result.push_back(canonicalVertex(vertices, order, i));
+    }
+    return result;
+}
+
+namespace detail {
+
+template <Scalar T>
+void copyCanonical(std::span<const Point<T>> vertices, CanonicalOrder order, std::span<Point<T>> canonical)
+{
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        canonical[i] = canonicalVertex(vertices, order, i);
+    }
+}
+
+// Hashes a ring already in canonical order and contiguous in memory. Each point pair feeds
+// four independent lanes, so successive rounds do not wait on each other.
+template <Scalar T>
+uint64_t hashCanonical(std::span<const Point<T>> canonical)
+{
+    std::array<uint64_t, 4> lanes = {hashPrime1 + hashPrime2, hashPrime2, 0, 0 - hashPrime1};
+
+    const size_t size = canonical.size();
+    size_t i = 0;
+    for (; i + 1 < size; i += 2)
+    {
+        lanes[0] = hashRound(lanes[0], coordinateBits(canonical[i].x));
+        lanes[1] = hashRound(lanes[1], coordinateBits(canonical[i].y));
+        lanes[2] = hashRound(lanes[2], coordinateBits(canonical[i + 1].x));
+        lanes[3] = hashRound(lanes[3], coordinateBits(canonical[i + 1].y));
+    }
+    if (i < size)
+    {
+        lanes[0] = hashRound(lanes[0], coordinateBits(canonical[i].x));
+        lanes[1] = hashRound(lanes[1], coordinateBits(canonical[i].y));
+    }
+
+    uint64_t hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+    hash += static_cast<uint64_t>(size);
+    hash ^= hash >> 33;
+    hash *= hashPrime2;
+    hash ^= hash >> 29;
+    hash *= hashPrime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+} // namespace detail
+
+// The canonical ring is copied out first (on the stack for up to eight vertices) and hashed contiguously.
+template <Scalar T>
+uint64_t canonicalHash(std::span<const Point<T>> vertices, CanonicalOrder order)
+{
+    constexpr size_t stackCapacity = 8;
+    if (vertices.size() <= stackCapacity)
+    {
+        std::array<Point<T>, stackCapacity> canonical;
+        detail::copyCanonical(vertices, order, std::span<Point<T>>(canonical.data(), vertices.size()));
+        return detail::hashCanonical(std::span<const Point<T>>(canonical.data(), vertices.size()));
+    }
+
+    std::vector<Point<T>> canonical(vertices.size());
+    detail::copyCanonical(vertices, order, std::span<Point<T>>(canonical));
+    return detail::hashCanonical(std::span<const Point<T>>(canonical));
+}
+
+template <Scalar T>
+uint64_t canonicalHash(std::span<const Point<T>> vertices)
+{
+    return canonicalHash(vertices, canonicalOrder(vertices));
+}
+
+// An interned figure keeps the vertex order of its first occurrence, with area and center computed once.
+template <typename F>
+struct InternedFigure {
+    F figure;
+    double area;
+    Point<FigureScalar<F>> center;
+    CanonicalOrder order;
+    uint64_t hash;
+};
+
+// ratio() is lookups per unique figure; bytesSaved counts the figure copies callers did not have to keep,
+// tableBytes what the table itself holds (shards, slots, entries and their spilled vertices).
+struct DedupStats {
+    size_t lookups;
+    size_t unique;
+    size_t bytesSaved;
+    size_t tableBytes;
+
+    double ratio() const noexcept
+    {
+        return unique == 0 ? 1 : static_cast<double>(lookups) / static_cast<double>(unique);
+    }
+
+    // Negative while the table costs more than the copies it spared.
+    int64_t netBytesSaved() const noexcept
+    {
+        return static_cast<int64_t>(bytesSaved) - static_cast<int64_t>(tableBytes);
+    }
+};
+
+// Concurrent interning table, sharded by hash: lookups take a shard's lock shared, inserts
+// take it exclusively. Returned references stay valid for the lifetime of the table.
+// internAll() accepts figures or vertex rings. It hashes a block of probes, sorts them by
+// shard and slot position, and sweeps each shard once under a single lock, so the slot
+// array is walked in address order instead of being hit at random.
+template <typename F>
+class DedupTable {
+private:
+    using T = FigureScalar<F>;
+    // Rings of up to this many vertices keep their canonical copy in the slot, so a probe
+    // is answered without dereferencing the entry.
+    constexpr static size_t slotCapacity_ = 4;
+    constexpr static size_t blockSize_ = 32768;
+    constexpr static size_t sortBuckets_ = 4096;
+    struct Slot {
+        uint64_t hash;
+        const InternedFigure<F>* entry;
+        size_t size;
+        std::array<Point<T>, slotCapacity_> canonical;
+    };
+    struct Probe {
+        std::span<const Point<T>> vertices;
+        CanonicalOrder order;
+        uint64_t hash;
+        std::array<Point<T>, slotCapacity_> canonical;
+    };
+    struct Counters {
+        size_t lookups = 0;
+        size_t bytesSaved = 0;
+    };
+    // Open addressing with linear probing, at most half full. The shard comes from the high half
+    // of the hash and the slot from the low half, scaled onto the array so slot order follows hash order.
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::atomic<size_t> lookups = 0;
+        std::atomic<size_t> bytesSaved = 0;
+        std::vector<Slot> slots;
+        std::deque<InternedFigure<F>> entries;
+    };
+private:
+    std::vector<Shard> shards_;
+public:
+    explicit DedupTable(size_t amountOfShards = 64);
+public:
+    DedupTable(const DedupTable&) = delete;
+    DedupTable& operator=(const DedupTable&) = delete;
+public:
+    const InternedFigure<F>& intern(const F& figure);
+    const InternedFigure<F>& intern(std::span<const Point<T>> vertices);
+    template <std::ranges::random_access_range Items>
+    std::vector<const InternedFigure<F>*> internAll(const Items& items);
+public:
+    DedupStats stats() const;
+private:
+    Probe makeProbe(std::span<const Point<T>> vertices) const;
+    size_t shardOf(uint64_t hash) const;
+    template <typename Make>
+    const InternedFigure<F>& resolve(const Probe& probe, Make&& make, Counters& counters);
+    template <typename Make>
+    void resolveRun(size_t index, std::span<const uint32_t> run, std::span<const Probe> probes,
+                    std::span<const InternedFigure<F>*> result, Make&& make);
+    void flush(size_t shard, const Counters& counters);
+    static const InternedFigure<F>& insert(Shard& shard, const Probe& probe, F figure);
+    static void reserve(Shard& shard, size_t amountOfEntries);
+    static const InternedFigure<F>* find(const Shard& shard, const Probe& probe);
+    static void place(std::vector<Slot>& slots, const Slot& slot);
+    static size_t slotOf(uint64_t hash, size_t amountOfSlots);
+    static size_t footprint(size_t amountOfVertices);
+};
+
+template <typename F>
+DedupTable<F>::DedupTable(size_t amountOfShards) : shards_(amountOfShards)
+{
+    if (amountOfShards == 0)
+    {
+        throw std::invalid_argument("dedup table needs at least one shard");
+    }
+}
+
+template <typename F>
+const InternedFigure<F>& DedupTable<F>::intern(const F& figure)
+{
+    Probe probe = makeProbe(figure.vertices());
+    Counters counters;
+    const InternedFigure<F>& entry = resolve(probe, [&] { return figure; }, counters);
+    flush(shardOf(probe.hash), counters);
+    return entry;
+}
+
+template <typename F>
+const InternedFigure<F>& DedupTable<F>::intern(std::span<const Point<T>> vertices)
+{
+    Probe probe = makeProbe(vertices);
+    Counters counters;
+    const InternedFigure<F>& entry = resolve(probe, [&] { return detail::makeFigure<F>(vertices); }, counters);
+    flush(shardOf(probe.hash), counters);
+    return entry;
+}
+
+template <typename F>
+template <std::ranges::random_access_range Items>
+std::vector<const InternedFigure<F>*> DedupTable<F>::internAll(const Items& items)
+{
+    using Item = std::remove_cvref_t<decltype(detail::asFigure(*std::ranges::begin(items)))>;
+    constexpr bool rings = std::is_convertible_v<const Item&, std::span<const Point<T>>>;
+    auto itemAt = [&](size_t i) -> const Item& {
+        return detail::asFigure(std::ranges::begin(items)[i]);
+    };
+
+    const size_t size = std::ranges::size(items);
+    std::vector<const InternedFigure<F>*> result(size);
+    const size_t block = std::min(size, blockSize_);
+    std::vector<Probe> probes(block);
+    std::vector<uint32_t> sorted(block);
+    // Buckets split every shard's slot array into equal ranges; sorting by bucket orders probes by slot position.
+    const size_t bucketsPerShard = std::max<size_t>(1, sortBuckets_ / shards_.size());
+    std::vector<size_t> offsets(shards_.size() * bucketsPerShard + 1);
+    auto bucketOf = [&](uint64_t hash) {
+        return shardOf(hash) * bucketsPerShard + (((hash & 0xFFFFFFFF) * bucketsPerShard) >> 32);
+    };
+
+    for (size_t first = 0; first < size; first += block)
+    {
+        const size_t count = std::min(block, size - first);
+        parallelFor(count, 4096, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                if constexpr (rings)
+                {
+                    probes[i] = makeProbe(itemAt(first + i));
+                }
+                else
+                {
+                    probes[i] = makeProbe(itemAt(first + i).vertices());
+                }
+            }
+        });
+
+        std::fill(offsets.begin(), offsets.end(), 0);
+        for (size_t i = 0; i < count; ++i)
+        {
+            ++offsets[bucketOf(probes[i].hash) + 1];
+        }
+        for (size_t bucket = 1; bucket < offsets.size(); ++bucket)
+        {
+            offsets[bucket] += offsets[bucket - 1];
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            sorted[offsets[bucketOf(probes[i].hash)]++] = static_cast<uint32_t>(i);
+        }
+        // The scatter advanced every bucket's offset to its end, so shard s now ends at offsets[(s + 1) * bucketsPerShard - 1].
+
+        std::span<const Probe> blockProbes(probes.data(), count);
+        std::span<const InternedFigure<F>*> blockResult(result.data() + first, count);
+        parallelFor(shards_.size(), 1, [&](size_t begin, size_t end, size_t) {
+            for (size_t shard = begin; shard < end; ++shard)
+            {
+                const size_t runBegin = shard == 0 ? 0 : offsets[shard * bucketsPerShard - 1];
+                const size_t runEnd = offsets[(shard + 1) * bucketsPerShard - 1];
+                std::span<const uint32_t> run(sorted.data() + runBegin, runEnd - runBegin);
+                resolveRun(shard, run, blockProbes, blockResult, [&](uint32_t i) -> F {
+                    if constexpr (rings)
+                    {
+                        return detail::makeFigure<F>(blockProbes[i].vertices);
+                    }
+                    else
+                    {
+                        return itemAt(first + i);
+                    }
+                });
+            }
+        });
+    }
+    return result;
+}
+
+template <typename F>
+DedupStats DedupTable<F>::stats() const
+{
+    DedupStats stats{0, 0, 0, 0};
+    for (const Shard& shard : shards_)
+    {
+        std::shared_lock lock(shard.mutex);
+        stats.lookups += shard.lookups.load(std::memory_order_relaxed);
+        stats.unique += shard.entries.size();
+        stats.bytesSaved += shard.bytesSaved.load(std::memory_order_relaxed);
+        stats.tableBytes += sizeof(Shard) + shard.slots.capacity() * sizeof(Slot);
+        for (const InternedFigure<F>& entry : shard.entries)
+        {
+            stats.tableBytes += sizeof(InternedFigure<F>) - sizeof(F) + footprint(entry.figure.vertices().size());
+        }
+    }
+    return stats;
+}
+
+template <typename F>
+typename DedupTable<F>::Probe DedupTable<F>::makeProbe(std::span<const Point<T>> vertices) const
+{
+    Probe probe{vertices, canonicalOrder(vertices), 0, {}};
+    if (vertices.size() <= slotCapacity_)
+    {
+        std::span<Point<T>> canonical(probe.canonical.data(), vertices.size());
+        detail::copyCanonical(vertices, probe.order, canonical);
+        probe.hash = detail::hashCanonical(std::span<const Point<T>>(canonical));
+    }
+    else
+    {
+        probe.hash = canonicalHash(vertices, probe.order);
+    }
+    return probe;
+}
+
+template <typename F>
+size_t DedupTable<F>::shardOf(uint64_t hash) const
+{
+    return (hash >> 32) % shards_.size();
+}
+
+template <typename F>
+template <typename Make>
+const InternedFigure<F>& DedupTable<F>::resolve(const Probe& probe, Make&& make, Counters& counters)
+{
+    Shard& shard = shards_[shardOf(probe.hash)];
+    ++counters.lookups;
+
+    {
+        std::shared_lock lock(shard.mutex);
+        if (const InternedFigure<F>* entry = find(shard, probe))
+        {
+            counters.bytesSaved += footprint(probe.vertices.size());
+            return *entry;
+        }
+    }
+
+    // The figure is built outside the exclusive lock; a racing insert of the same figure wins.
+    F figure = make();
+
+    std::unique_lock lock(shard.mutex);
+    if (const InternedFigure<F>* entry = find(shard, probe))
+    {
+        counters.bytesSaved += footprint(probe.vertices.size());
+        return *entry;
+    }
+    reserve(shard, shard.entries.size() + 1);
+    return insert(shard, probe, std::move(figure));
+}
+
+// Resolves one shard's probes of a block, in slot order: hits under one shared lock, then the
+// misses under one exclusive lock, after growing the slot array once for all of them.
+template <typename F>
+template <typename Make>
+void DedupTable<F>::resolveRun(size_t index, std::span<const uint32_t> run, std::span<const Probe> probes,
+                               std::span<const InternedFigure<F>*> result, Make&& make)
+{
+    if (run.empty())
+    {
+        return;
+    }
+    Shard& shard = shards_[index];
+    Counters counters{run.size(), 0};
+    size_t misses = 0;
+    {
+        std::shared_lock lock(shard.mutex);
+        for (uint32_t i : run)
+        {
+            result[i] = find(shard, probes[i]);
+            if (result[i] != nullptr)
+            {
+                counters.bytesSaved += footprint(probes[i].vertices.size());
+            }
+            else
+            {
+                ++misses;
+            }
+        }
+    }
+
+    if (misses != 0)
+    {
+        std::unique_lock lock(shard.mutex);
+        reserve(shard, shard.entries.size() + misses);
+        for (uint32_t i : run)
+        {
+            if (result[i] != nullptr)
+            {
+                continue;
+            }
+            // Repeats within the block, or a concurrent insert, find the entry here.
+            result[i] = find(shard, probes[i]);
+            if (result[i] != nullptr)
+            {
+                counters.bytesSaved += footprint(probes[i].vertices.size());
+            }
+            else
+            {
+                result[i] = &insert(shard, probes[i], make(i));
+            }
+        }
+    }
+    flush(index, counters);
+}
+
+template <typename F>
+void DedupTable<F>::flush(size_t shard, const Counters& counters)
+{
+    if (counters.lookups != 0)
+    {
+        shards_[shard].lookups.fetch_add(counters.lookups, std::memory_order_relaxed);
+        shards_[shard].bytesSaved.fetch_add(counters.bytesSaved, std::memory_order_relaxed);
+    }
+}
+
+// Called under the shard's exclusive lock, with room reserved for the new entry.
+template <typename F>
+const InternedFigure<F>& DedupTable<F>::insert(Shard& shard, const Probe& probe, F figure)
+{
+    double area = static_cast<double>(figure);
+    Point<T> center = figure.calcGeometricCenter();
+    const InternedFigure<F>& entry = shard.entries.emplace_back(std::move(figure), area, center, probe.order, probe.hash);
+    place(shard.slots, Slot{probe.hash, &entry, probe.vertices.size(), probe.canonical});
+    return entry;
+}
+
+template <typename F>
+void DedupTable<F>::reserve(Shard& shard, size_t amountOfEntries)
+{
+    if (amountOfEntries * 2 <= shard.slots.size())
+    {
+        return;
+    }
+    size_t amountOfSlots = std::max<size_t>(16, shard.slots.size());
+    while (amountOfEntries * 2 > amountOfSlots)
+    {
+        amountOfSlots *= 2;
+    }
+    std::vector<Slot> slots(amountOfSlots, Slot{0, nullptr, 0, {}});
+    for (const Slot& slot : shard.slots)
+    {
+        if (slot.entry != nullptr)
+        {
+            place(slots, slot);
+        }
+    }
+    shard.slots.swap(slots);
+}
+
+template <typename F>
+const InternedFigure<F>* DedupTable<F>::find(const Shard& shard, const Probe& probe)
+{
+    if (shard.slots.empty())
+    {
+        return nullptr;
+    }
+    const size_t size = probe.vertices.size();
+    const size_t amountOfSlots = shard.slots.size();
+    for (size_t i = slotOf(probe.hash, amountOfSlots); shard.slots[i].entry != nullptr; i = i + 1 == amountOfSlots ? 0 : i + 1)
+    {
+        const Slot& slot = shard.slots[i];
+        if (slot.hash != probe.hash || slot.size != size)
+        {
+            continue;
+        }
+        bool equal = true;
+        if (size <= slotCapacity_)
+        {
+            for (size_t k = 0; k < size && equal; ++k)
+            {
+                equal = slot.canonical[k].x == probe.canonical[k].x && slot.canonical[k].y == probe.canonical[k].y;
+            }
+        }
+        else
+        {
+            equal = detail::equalCanonical(slot.entry->figure.vertices(), slot.entry->order, probe.vertices, probe.order);
+        }
+        if (equal)
+        {
+            return slot.entry;
+        }
+    }
+    return nullptr;
+}
+
+template <typename F>
+void DedupTable<F>::place(std::vector<Slot>& slots, const Slot& slot)
+{
+    size_t i = slotOf(slot.hash, slots.size());
+    while (slots[i].entry != nullptr)
+    {
+        i = i + 1 == slots.size() ? 0 : i + 1;
+    }
+    slots[i] = slot;
+}
+
+// Scales the low half of the hash onto [0, amountOfSlots) with a multiply instead of a mask.
+template <typename F>
+size_t DedupTable<F>::slotOf(uint64_t hash, size_t amountOfSlots)
+{
+    return static_cast<size_t>(((hash & 0xFFFFFFFF) * amountOfSlots) >> 32);
+}
+
+// Bytes a caller keeps per figure copy: the object itself plus any vertices spilled to the heap.
+template <typename F>
+size_t DedupTable<F>::footprint(size_t amountOfVertices)
+{
+    const size_t heap = amountOfVertices > detail::inlineCapacityOf(static_cast<const F*>(nullptr)) ? amountOfVertices * sizeof(Point<T>) : 0;
+    return sizeof(F) + heap;
+}
+
+#endif //FIGUREDEDUP_H
@@ -0,0 +1,433 @@
+#ifndef FIGUREQUERIES_H
+#define FIGUREQUERIES_H
+
+#include "Figure.h"
+#include "FigureTraits.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <queue>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Queries over figure collections work on keys extracted once into a contiguous array,
+// so the virtual area/center calls happen exactly once per figure.
+
+struct AreaKey {
+    template <typename F>
+    double operator()(const F& figure) const
+    {
+        return static_cast<double>(detail::asFigure(figure));
+    }
+};
+
+struct CenterXKey {
+    template <typename F>
+    double operator()(const F& figure) const
+    {
+        return static_cast<double>(detail::asFigure(figure).calcGeometricCenter().x);
+    }
+};
+
+struct CenterYKey {
+    template <typename F>
+    double operator()(const F& figure) const
+    {
+        return static_cast<double>(detail::asFigure(figure).calcGeometricCenter().y);
+    }
+};
+
+template <std::ranges::random_access_range Figures, typename Key = AreaKey>
+std::vector<double> computeKeys(const Figures& figures, Key key = {})
+{
+    const size_t size = std::ranges::size(figures);
+    std::vector<double> keys(size);
+    parallelFor(size, 16384, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            keys[i] = key(std::ranges::begin(figures)[i]);
+        }
+    });
+    return keys;
+}
+
+// Maps a double onto an unsigned integer with the same ordering, so it can be radix sorted.
+inline uint64_t orderedBits(double key)
+{
+    uint64_t bits = std::bit_cast<uint64_t>(key);
+    return (bits & (uint64_t(1) << 63)) ? ~bits : bits | (uint64_t(1) << 63);
+}
+
+// Stable parallel LSD radix sort of (key, index) pairs over 8-bit digits; returns the index order.
+inline std::vector<size_t> radixSortIndices(std::span<const uint64_t> keys)
+{
+    constexpr size_t radix = 256;
+    constexpr size_t grain = 65536;
+    const size_t size = keys.size();
+
+    std::vector<uint64_t> currentKeys(keys.begin(), keys.end());
+    std::vector<uint64_t> nextKeys(size);
+    std::vector<size_t> currentIndices(size);
+    std::vector<size_t> nextIndices(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        currentIndices[i] = i;
+    }
+
+    const size_t workers = parallelWorkers(size, grain);
+    std::vector<std::array<size_t, radix>> histograms(workers);
+    for (unsigned shift = 0; shift < 64; shift += 8)
+    {
+        parallelFor(size, grain, [&](size_t begin, size_t end, size_t worker) {
+            auto& histogram = histograms[worker];
+            histogram.fill(0);
+            for (size_t i = begin; i < end; ++i)
+            {
+                ++histogram[(currentKeys[i] >> shift) & (radix - 1)];
+            }
+        });
+
+        // A digit shared by every key leaves the order unchanged; skip the scatter.
+        bool trivial = false;
+        for (size_t digit = 0; digit < radix && !trivial; ++digit)
+        {
+            size_t total = 0;
+            for (const auto& histogram : histograms)
+            {
+                total += histogram[digit];
+            }
+            trivial = total == size;
+        }
+        if (trivial)
+        {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (size_t digit = 0; digit < radix; ++digit)
+        {
+            for (auto& histogram : histograms)
+            {
+                size_t count = histogram[digit];
+                histogram[digit] = offset;
+                offset += count;
+            }
+        }
+
+        parallelFor(size, grain, [&](size_t begin, size_t end, size_t worker) {
+            auto& offsets = histograms[worker];
+            for (size_t i = begin; i < end; ++i)
+            {
+                size_t position = offsets[(currentKeys[i] >> shift) & (radix - 1)]++;
+                nextKeys[position] = currentKeys[i];
+                nextIndices[position] = currentIndices[i];
+            }
+        });
+        currentKeys.swap(nextKeys);
+        currentIndices.swap(nextIndices);
+    }
+
+    return currentIndices;
+}
+
+// Indices of `keys` in ascending (or descending) key order; ties keep their original order.
+inline std::vector<size_t> sortIndicesByKey(std::span<const double> keys, bool descending = false)
+{
+    std::vector<uint64_t> bits(keys.size());
+    parallelFor(keys.size(), 65536, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            bits[i] = descending ? ~orderedBits(keys[i]) : orderedBits(keys[i]);
+        }
+    });
+    return radixSortIndices(bits);
+}
+
+// Streaming top-k: a min-heap of the k largest keys seen so far. Non-finite keys are skipped:
+// NaN has no place in the heap's ordering, and infinities have no meaningful rank among areas.
+class TopK {
+private:
+    using Entry = std::pair<double, size_t>;
+private:
+    size_t k_;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> heap_;
+public:
+    explicit TopK(size_t k);
+public:
+    void push(double key, size_t index);
+    void merge(const TopK& rhs);
+    std::vector<size_t> result() const;
+};
+
+inline TopK::TopK(size_t k) : k_(k) {}
+
+inline void TopK::push(double key, size_t index)
+{
+    if (k_ == 0 || !std::isfinite(key))
+    {
+        return;
+    }
+    if (heap_.size() < k_)
+    {
+        heap_.emplace(key, index);
+    }
+    else if (heap_.top().first < key)
+    {
+        heap_.pop();
+        heap_.emplace(key, index);
+    }
+}
+
+inline void TopK::merge(const TopK& rhs)
+{
+    auto copy = rhs.heap_;
+    while (!copy.empty())
+    {
+        push(copy.top().first, copy.top().second);
+        copy.pop();
+    }
+}
+
+inline std::vector<size_t> TopK::result() const
+{
+    auto copy = heap_;
+    std::vector<size_t> indices(copy.size());
+    for (size_t i = indices.size(); i > 0; --i)
+    {
+        indices[i - 1] = copy.top().second;
+        copy.pop();
+    }
+    return indices;
+}
+
+// Indices of the k largest finite keys, largest first.
+inline std::vector<size_t> topK(std::span<const double> keys, size_t k)
+{
+    std::vector<TopK> partial(parallelWorkers(keys.size(), 65536), TopK(k));
+    parallelFor(keys.size(), 65536, [&](size_t begin, size_t end, size_t worker) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            partial[worker].push(keys[i], i);
+        }
+    });
+
+    TopK result(k);
+    for (const auto& heap : partial)
+    {
+        result.merge(heap);
+    }
+    return result.result();
+}
+
+// Mergeable quantile sketch with logarithmic buckets: every reported quantile is
+// within a relative error of `relativeAccuracy` of a key of the right rank. Non-finite keys
+// are not counted.
+class QuantileSketch {
+private:
+    double relativeAccuracy_;
+    double gamma_;
+    double logGamma_;
+    std::map<int, uint64_t> positive_;
+    std::map<int, uint64_t> negative_;
+    uint64_t zeros_ = 0;
+    uint64_t count_ = 0;
+public:
+    explicit QuantileSketch(double relativeAccuracy = 0.01);
+public:
+    void add(double key);
+    void merge(const QuantileSketch& rhs);
+public:
+    uint64_t count() const noexcept;
+    double quantile(double q) const;
+private:
+    int bucketOf(double magnitude) const;
+    double valueOf(int bucket) const;
+};
+
+inline QuantileSketch::QuantileSketch(double relativeAccuracy)
+    : relativeAccuracy_(relativeAccuracy),
+      gamma_((1 + relativeAccuracy) / (1 - relativeAccuracy)),
+      logGamma_(std::log(gamma_))
+{
+    if (!(relativeAccuracy > 0 && relativeAccuracy < 1))
+    {
+        throw std::invalid_argument("relative accuracy must be in (0, 1)");
+    }
+}
+
+inline void QuantileSketch::add(double key)
+{
+    if (!std::isfinite(key))
+    {
+        return;
+    }
+    if (key > 0)
+    {
+        ++positive_[bucketOf(key)];
+    }
+    else if (key < 0)
+    {
+        ++negative_[bucketOf(-key)];
+    }
+    else
+    {
+        ++zeros_;
+    }
+    ++count_;
+}
+
+inline void QuantileSketch::merge(const QuantileSketch& rhs)
+{
+    if (rhs.relativeAccuracy_ != relativeAccuracy_)
+    {
+        throw std::invalid_argument("sketches with different accuracy");
+    }
+    for (const auto& [bucket, amount] : rhs.positive_)
+    {
+        positive_[bucket] += amount;
+    }
+    for (const auto& [bucket, amount] : rhs.negative_)
+    {
+        negative_[bucket] += amount;
+    }
+    zeros_ += rhs.zeros_;
+    count_ += rhs.count_;
+}
+
+inline uint64_t QuantileSketch::count() const noexcept
+{
+    return count_;
+}
+
+inline double QuantileSketch::quantile(double q) const
+{
+    if (count_ == 0 || !(q >= 0 && q <= 1))
+    {
+        throw std::invalid_argument("quantile of an empty sketch or outside [0, 1]");
+    }
+
+    uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(count_ - 1));
+    uint64_t seen = 0;
+    for (auto it = negative_.rbegin(); it != negative_.rend(); ++it)
+    {
+        seen += it->second;
+        if (seen > rank)
+        {
+            return -valueOf(it->first);
+        }
+    }
+    seen += zeros_;
+    if (seen > rank)
+    {
+        return 0;
+    }
+    for (const auto& [bucket, amount] : positive_)
+    {
+        seen += amount;
+        if (seen > rank)
+        {
+            return valueOf(bucket);
+        }
+    }
+    return valueOf(positive_.rbegin()->first);
+}
+
+inline int QuantileSketch::bucketOf(double magnitude) const
+{
+    return static_cast<int>(std::ceil(std::log(magnitude) / logGamma_));
+}
+
+inline double QuantileSketch::valueOf(int bucket) const
+{
+    return 2 * std::pow(gamma_, bucket) / (gamma_ + 1);
+}
+
+inline QuantileSketch buildQuantileSketch(std::span<const double> keys, double relativeAccuracy = 0.01)
+{
+    std::vector<QuantileSketch> partial(parallelWorkers(keys.size(), 65536), QuantileSketch(relativeAccuracy));
+    parallelFor(keys.size(), 65536, [&](size_t begin, size_t end, size_t worker) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            partial[worker].add(keys[i]);
+        }
+    });
+
+    QuantileSketch result(relativeAccuracy);
+    for (const auto& sketch : partial)
+    {
+        result.merge(sketch);
+    }
+    return result;
+}
+
+// Equal-width bins over finite [min, max]; keys outside the range are clamped into the edge bins,
+// non-finite keys are skipped.
+struct Histogram {
+    double min;
+    double max;
+    std::vector<uint64_t> counts;
+};
+
+inline Histogram buildHistogram(std::span<const double> keys, size_t amountOfBins, double min, double max)
+{
+    if (amountOfBins == 0 || !std::isfinite(min) || !std::isfinite(max) || !(min <= max))
+    {
+        throw std::invalid_argument("invalid histogram bounds");
+    }
+
+    const double width = (max - min) / static_cast<double>(amountOfBins);
+    std::vector<std::vector<uint64_t>> partial(parallelWorkers(keys.size(), 65536), std::vector<uint64_t>(amountOfBins, 0));
+    parallelFor(keys.size(), 65536, [&](size_t begin, size_t end, size_t worker) {
+        auto& counts = partial[worker];
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (!std::isfinite(keys[i]))
+            {
+                continue;
+            }
+            double bin = width > 0 ? std::floor((keys[i] - min) / width) : 0;
+            ++counts[static_cast<size_t>(std::clamp(bin, 0.0, static_cast<double>(amountOfBins - 1)))];
+        }
+    });
+
+    Histogram histogram{min, max, std::vector<uint64_t>(amountOfBins, 0)};
+    for (const auto& counts : partial)
+    {
+        for (size_t bin = 0; bin < amountOfBins; ++bin)
+        {
+            histogram.counts[bin] += counts[bin];
+        }
+    }
+    return histogram;
+}
+
+inline Histogram buildHistogram(std::span<const double> keys, size_t amountOfBins)
+{
+    // NaNs and infinities would poison min/max, so the bounds come from the finite keys only.
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    for (double key : keys)
+    {
+        if (std::isfinite(key))
+        {
+            min = std::min(min, key);
+            max = std::max(max, key);
+        }
+    }
+    if (min > max)
+    {
+        return buildHistogram(keys, amountOfBins, 0, 0);
+    }
+    return buildHistogram(keys, amountOfBins, min, max);
+}
+
+#endif //FIGUREQUERIES_H
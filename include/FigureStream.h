@@ -0,0 +1,179 @@
+#ifndef FIGURESTREAM_H
+#define FIGURESTREAM_H
+
+#include "Generator.h"
+#include "Polygon.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <expected>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Lazy figure parsing: one figure per line, given as whitespace-separated x y pairs.
+// Fixed-size figures (Rectangle, Square, Trapezoid) need exactly their vertex count;
+// a general Polygon takes however many pairs the line holds, at least three.
+// A malformed line yields a ParseError for that record and parsing moves on.
+
+struct ParseError {
+    size_t record;
+    std::string message;
+};
+
+template <typename F>
+using ParseResult = std::expected<F, ParseError>;
+
+template <typename F>
+ParseResult<F> parseFigure(std::string_view line, size_t record);
+
+// The stream must outlive the generator; it is read in chunks of `chunkSize` bytes.
+template <typename F>
+Generator<ParseResult<F>> readFigures(std::istream& istream, size_t chunkSize = 64 * 1024);
+
+// The buffer must outlive the generator; lines are parsed in place without copying.
+template <typename F>
+Generator<ParseResult<F>> readFigures(std::string_view buffer);
+
+namespace detail {
+
+inline bool isBlank(std::string_view line)
+{
+    return line.find_first_not_of(" \t\r") == std::string_view::npos;
+}
+
+} // namespace detail
+
+template <typename F>
+ParseResult<F> parseFigure(std::string_view line, size_t record)
+{
+    using T = FigureScalar<F>;
+
+    std::vector<T> values;
+    const char* cursor = line.data();
+    const char* end = line.data() + line.size();
+    while (true)
+    {
+        while (cursor != end && (*cursor == ' ' || *cursor == '\t' || *cursor == '\r'))
+        {
+            ++cursor;
+        }
+        if (cursor == end)
+        {
+            break;
+        }
+
+        T value{};
+        // from_chars rejects a leading '+', which operator>> accepts before a digit or '.' only.
+        const bool plus = *cursor == '+' && cursor + 1 != end && (std::isdigit(static_cast<unsigned char>(cursor[1])) || cursor[1] == '.');
+        const char* start = plus ? cursor + 1 : cursor;
+        auto [next, error] = std::from_chars(start, end, value);
+        if (error != std::errc() || (next != end && *next != ' ' && *next != '\t' && *next != '\r'))
+        {
+            return std::unexpected(ParseError{record, "incorrect type provided"});
+        }
+        // from_chars also reads "inf" and "nan", which operator>> rejects.
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            if (!std::isfinite(value))
+            {
+                return std::unexpected(ParseError{record, "incorrect type provided"});
+            }
+        }
+        values.push_back(value);
+        cursor = next;
+    }
+
+    if (values.size() % 2 != 0)
+    {
+        return std::unexpected(ParseError{record, "invalid point"});
+    }
+
+    std::vector<Point<T>> points;
+    points.reserve(values.size() / 2);
+    for (size_t i = 0; i < values.size(); i += 2)
+    {
+        points.emplace_back(values[i], values[i + 1]);
+    }
+
+    if constexpr (std::is_constructible_v<F, std::vector<Point<T>>>)
+    {
+        if (points.size() < 3)
+        {
+            return std::unexpected(ParseError{record, "invalid amount of points"});
+        }
+        return F(std::move(points));
+    }
+    else
+    {
+        F figure;
+        if (points.size() != figure.vertices().size())
+        {
+            return std::unexpected(ParseError{record, "invalid amount of points"});
+        }
+        // One bulk assignment, so the metrics match what the constructors and operator>> compute.
+        figure.setVertices(points);
+        return figure;
+    }
+}
+
+template <typename F>
+Generator<ParseResult<F>> readFigures(std::istream& istream, size_t chunkSize)
+{
+    std::vector<char> chunk(std::max<size_t>(chunkSize, 1));
+    std::string pending;
+    size_t record = 0;
+
+    while (istream)
+    {
+        istream.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        std::string_view data(chunk.data(), static_cast<size_t>(istream.gcount()));
+
+        size_t newline;
+        while ((newline = data.find('\n')) != std::string_view::npos)
+        {
+            ++record;
+            std::string_view line = data.substr(0, newline);
+            // A line split across chunks is stitched together; otherwise it is parsed straight from the chunk.
+            if (!pending.empty())
+            {
+                pending.append(line);
+                line = pending;
+            }
+            if (!detail::isBlank(line))
+            {
+                co_yield parseFigure<F>(line, record);
+            }
+            pending.clear();
+            data.remove_prefix(newline + 1);
+        }
+        pending.append(data);
+    }
+
+    if (!detail::isBlank(pending))
+    {
+        co_yield parseFigure<F>(pending, record + 1);
+    }
+}
+
+template <typename F>
+Generator<ParseResult<F>> readFigures(std::string_view buffer)
+{
+    size_t record = 0;
+    while (!buffer.empty())
+    {
+        ++record;
+        size_t newline = buffer.find('\n');
+        std::string_view line = buffer.substr(0, newline);
+        if (!detail::isBlank(line))
+        {
+            co_yield parseFigure<F>(line, record);
+        }
+        buffer.remove_prefix(newline == std::string_view::npos ? buffer.size() : newline + 1);
+    }
+}
+
+#endif //FIGURESTREAM_H
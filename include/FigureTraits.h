@@ -0,0 +1,22 @@
+#ifndef FIGURETRAITS_H
+#define FIGURETRAITS_H
+
+namespace detail {
+
+// Collections hold figures by value or through pointer-like handles; asFigure yields the figure either way.
+template <typename F>
+decltype(auto) asFigure(const F& figure)
+{
+    if constexpr (requires { *figure; })
+    {
+        return *figure;
+    }
+    else
+    {
+        return (figure);
+    }
+}
+
+} // namespace detail
+
+#endif //FIGURETRAITS_H
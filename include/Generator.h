@@ -0,0 +1,160 @@
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <utility>
+
+// Lazily produced sequence backed by a coroutine; a move-only input view, so it
+// composes with std::views adaptors and is consumed in a single pass.
+template <typename T>
+class Generator : public std::ranges::view_interface<Generator<T>> {
+public:
+    class promise_type;
+    class iterator;
+private:
+    using Handle = std::coroutine_handle<promise_type>;
+private:
+    Handle handle_;
+public:
+    Generator() noexcept = default;
+    explicit Generator(Handle handle) noexcept;
+public:
+    Generator(const Generator&) = delete;
+    Generator& operator=(const Generator&) = delete;
+public:
+    Generator(Generator&& rhs) noexcept;
+    Generator& operator=(Generator&& rhs) noexcept;
+public:
+    ~Generator() noexcept;
+public:
+    iterator begin();
+    std::default_sentinel_t end() const noexcept;
+};
+
+template <typename T>
+class Generator<T>::promise_type {
+private:
+    std::optional<T> current_;
+    std::exception_ptr exception_;
+public:
+    Generator get_return_object() noexcept
+    {
+        return Generator(Handle::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() const noexcept
+    {
+        return {};
+    }
+    std::suspend_always final_suspend() const noexcept
+    {
+        return {};
+    }
+    std::suspend_always yield_value(T value) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        current_.emplace(std::move(value));
+        return {};
+    }
+    void return_void() const noexcept {}
+    void unhandled_exception() noexcept
+    {
+        exception_ = std::current_exception();
+    }
+    template <typename U>
+    std::suspend_never await_transform(U&&) = delete;
+public:
+    T& value() noexcept
+    {
+        return *current_;
+    }
+    void rethrowIfFailed() const
+    {
+        if (exception_)
+        {
+            std::rethrow_exception(exception_);
+        }
+    }
+};
+
+template <typename T>
+class Generator<T>::iterator {
+private:
+    Handle handle_;
+public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+public:
+    iterator() noexcept = default;
+    explicit iterator(Handle handle) noexcept : handle_(handle) {}
+public:
+    T& operator*() const noexcept
+    {
+        return handle_.promise().value();
+    }
+    iterator& operator++()
+    {
+        handle_.resume();
+        handle_.promise().rethrowIfFailed();
+        return *this;
+    }
+    void operator++(int)
+    {
+        ++*this;
+    }
+    friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept
+    {
+        return !it.handle_ || it.handle_.done();
+    }
+};
+
+template <typename T>
+Generator<T>::Generator(Handle handle) noexcept : handle_(handle) {}
+
+template <typename T>
+Generator<T>::Generator(Generator&& rhs) noexcept : handle_(std::exchange(rhs.handle_, nullptr)) {}
+
+template <typename T>
+Generator<T>& Generator<T>::operator=(Generator&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+        handle_ = std::exchange(rhs.handle_, nullptr);
+    }
+    return *this;
+}
+
+template <typename T>
+Generator<T>::~Generator() noexcept
+{
+    if (handle_)
+    {
+        handle_.destroy();
+    }
+}
+
+template <typename T>
+typename Generator<T>::iterator Generator<T>::begin()
+{
+    if (handle_)
+    {
+        handle_.resume();
+        handle_.promise().rethrowIfFailed();
+    }
+    return iterator(handle_);
+}
+
+template <typename T>
+std::default_sentinel_t Generator<T>::end() const noexcept
+{
+    return {};
+}
+
+#endif //GENERATOR_H
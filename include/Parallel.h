@@ -0,0 +1,47 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Number of workers parallelFor uses for `count` items, at least `grain` items each.
+inline size_t parallelWorkers(size_t count, size_t grain)
+{
+    size_t hardware = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    size_t byGrain = std::max<size_t>(count / std::max<size_t>(grain, 1), 1);
+    return std::min(hardware, byGrain);
+}
+
+// Splits [0, count) into parallelWorkers(count, grain) contiguous chunks and calls
+// func(begin, end, worker) for each; worker 0 runs on the calling thread.
+// The partition depends only on count and grain, so repeated calls see the same chunks.
+template <typename Func>
+void parallelFor(size_t count, size_t grain, Func&& func)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    size_t workers = parallelWorkers(count, grain);
+    size_t chunk = (count + workers - 1) / workers;
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (size_t worker = 1; worker < workers; ++worker)
+    {
+        size_t begin = std::min(worker * chunk, count);
+        size_t end = std::min(begin + chunk, count);
+        threads.emplace_back([&func, begin, end, worker] { func(begin, end, worker); });
+    }
+    func(0, std::min(chunk, count), 0);
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+#endif //PARALLEL_H
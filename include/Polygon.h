@@ -2,108 +2,195 @@
 #define POLYGON_H
 
 #include "Figure.h"
+#include "VertexBuffer.h"
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
-#include <memory>
 
-template <Scalar T>
+template <Scalar T, size_t InlineCapacity = 8>
 class Polygon : public Figure<T> {
 protected:
-    std::vector<std::unique_ptr<Point<T>>> vertices_;
-protected:
+    VertexBuffer<T, InlineCapacity> vertices_;
+private:
+    constexpr static size_t recalculationInterval_ = 4096;
+    double doubledArea_ = 0;
+    T sumX_ = 0;
+    T sumY_ = 0;
+    size_t editsSinceRecalculation_ = 0;
+public:
     explicit Polygon(size_t amountOfVertices);
     Polygon(const std::initializer_list<Point<T>>& rhs);
-protected:
+    explicit Polygon(std::vector<Point<T>> points);
+public:
     Polygon(const Polygon&) = default;
     Polygon& operator=(const Polygon&) = default;
-protected:
+public:
     Polygon(Polygon&&) noexcept = default;
     Polygon& operator=(Polygon&&) noexcept = default;
 public:
     ~Polygon() noexcept override = default;
+public:
+    std::span<const Point<T>> vertices() const noexcept;
+    void setVertex(size_t index, const Point<T>& point);
+    void setVertices(std::span<const Point<T>> points);
 public:
     Point<T> calcGeometricCenter() const override;
 public:
     explicit operator double() const override;
+private:
+    static double edgeTerm(const Point<T>& from, const Point<T>& to);
+    void recalculateMetrics();
 public:
-    template <Scalar U>
-    friend std::istream& operator>>(std::istream& istream, Polygon<U>& rhs);
-    template <Scalar U>
-    friend std::ostream& operator<<(std::ostream& ostream, const Polygon<U>& rhs);
+    template <Scalar U, size_t N>
+    friend std::istream& operator>>(std::istream& istream, Polygon<U, N>& rhs);
+    template <Scalar U, size_t N>
+    friend std::ostream& operator<<(std::ostream& ostream, const Polygon<U, N>& rhs);
 };
 
-template <Scalar T>
-Polygon<T>::Polygon(size_t amountOfVertices) : vertices_(amountOfVertices)
+// Coordinate type of a polygon-like figure, deduced from its vertices().
+template <typename F>
+using FigureScalar = std::remove_cvref_t<decltype(std::declval<const F&>().vertices()[0].x)>;
+
+template <Scalar T, size_t InlineCapacity>
+Polygon<T, InlineCapacity>::Polygon(size_t amountOfVertices) : vertices_(amountOfVertices)
+{
+    recalculateMetrics();
+}
+
+template <Scalar T, size_t InlineCapacity>
+Polygon<T, InlineCapacity>::Polygon(const std::initializer_list<Point<T>>& rhs) : vertices_(rhs)
+{
+    recalculateMetrics();
+}
+
+template <Scalar T, size_t InlineCapacity>
+Polygon<T, InlineCapacity>::Polygon(std::vector<Point<T>> points) : vertices_(std::move(points))
+{
+    recalculateMetrics();
+}
+
+template <Scalar T, size_t InlineCapacity>
+std::span<const Point<T>> Polygon<T, InlineCapacity>::vertices() const noexcept
+{
+    return vertices_.view();
+}
+
+template <Scalar T, size_t InlineCapacity>
+void Polygon<T, InlineCapacity>::setVertex(size_t index, const Point<T>& point)
 {
-    for (auto& vert : vertices_)
+    const size_t size = vertices_.size();
+    if (index >= size)
     {
-        vert = std::make_unique<Point<T>>();
+        throw std::out_of_range("vertex index out of range");
+    }
+
+    // Only the two edges touching the vertex change, so the shoelace and vertex sums are patched in O(1).
+    const Point<T>& prev = vertices_[(index + size - 1) % size];
+    const Point<T>& next = vertices_[(index + 1) % size];
+    const Point<T> old = vertices_[index];
+    doubledArea_ += (edgeTerm(prev, point) + edgeTerm(point, next)) - (edgeTerm(prev, old) + edgeTerm(old, next));
+    sumX_ += point.x - old.x;
+    sumY_ += point.y - old.y;
+    vertices_.mutableAt(index) = point;
+
+    // Bound floating-point drift of the running sums by refreshing them periodically.
+    if (++editsSinceRecalculation_ >= recalculationInterval_)
+    {
+        recalculateMetrics();
     }
 }
 
-template <Scalar T>
-Polygon<T>::Polygon(const std::initializer_list<Point<T>>& rhs) : vertices_(rhs.size())
+// Replaces every vertex at once; the metrics are recomputed in full, exactly as the constructors do.
+template <Scalar T, size_t InlineCapacity>
+void Polygon<T, InlineCapacity>::setVertices(std::span<const Point<T>> points)
 {
-    size_t i = 0;
-    for (const auto& point : rhs)
+    if (points.size() != vertices_.size())
     {
-        vertices_[i++] = std::make_unique<Point<T>>(point.x, point.y);
+        throw std::invalid_argument("invalid amount of points");
     }
+
+    std::copy(points.begin(), points.end(), vertices_.mutableView().begin());
+    recalculateMetrics();
 }
 
-template <Scalar T>
-Point<T> Polygon<T>::calcGeometricCenter() const
+template <Scalar T, size_t InlineCapacity>
+Point<T> Polygon<T, InlineCapacity>::calcGeometricCenter() const
 {
     if (vertices_.empty())
     {
         return Point<T>();
     }
 
-    T xResult = 0;
-    T yResult = 0;
-    for (size_t i = 0; i < vertices_.size(); ++i)
-    {
-        xResult += vertices_[i]->x;
-        yResult += vertices_[i]->y;
-    }
-
-    return Point<T>(xResult / static_cast<T>(vertices_.size()), yResult / static_cast<T>(vertices_.size()));
+    return Point<T>(sumX_ / static_cast<T>(vertices_.size()), sumY_ / static_cast<T>(vertices_.size()));
 }
 
-template <Scalar T>
-Polygon<T>::operator double() const
+template <Scalar T, size_t InlineCapacity>
+Polygon<T, InlineCapacity>::operator double() const
 {
     if (vertices_.empty())
     {
         return 0;
     }
 
+    return std::abs(doubledArea_) / 2;
+}
+
+template <Scalar T, size_t InlineCapacity>
+double Polygon<T, InlineCapacity>::edgeTerm(const Point<T>& from, const Point<T>& to)
+{
+    return static_cast<double>(from.x * to.y) - static_cast<double>(to.x * from.y);
+}
+
+template <Scalar T, size_t InlineCapacity>
+void Polygon<T, InlineCapacity>::recalculateMetrics()
+{
     double area = 0;
+    T xResult = 0;
+    T yResult = 0;
     for (size_t i = 0; i < vertices_.size(); ++i)
     {
         size_t j = (i + 1) % vertices_.size();
-        area += vertices_[i]->x * vertices_[j]->y;
-        area -= vertices_[j]->x * vertices_[i]->y;
+        area += vertices_[i].x * vertices_[j].y;
+        area -= vertices_[j].x * vertices_[i].y;
+        xResult += vertices_[i].x;
+        yResult += vertices_[i].y;
     }
 
-    return std::abs(area) / 2;
+    doubledArea_ = area;
+    sumX_ = xResult;
+    sumY_ = yResult;
+    editsSinceRecalculation_ = 0;
 }
 
-template <Scalar T>
-std::istream& operator>>(std::istream& istream, Polygon<T>& rhs)
+template <Scalar T, size_t InlineCapacity>
+std::istream& operator>>(std::istream& istream, Polygon<T, InlineCapacity>& rhs)
 {
-    for (size_t i = 0; i < rhs.vertices_.size(); ++i)
+    try
     {
-        if (!(istream >> *rhs.vertices_[i]))
+        for (auto& point : rhs.vertices_.mutableView())
         {
-            throw std::invalid_argument("invalid point");
+            if (!(istream >> point))
+            {
+                throw std::invalid_argument("invalid point");
+            }
         }
     }
+    catch (...)
+    {
+        rhs.recalculateMetrics();
+        throw;
+    }
+    rhs.recalculateMetrics();
 
     return istream;
 }
 
-template <Scalar T>
-std::ostream& operator<<(std::ostream& ostream, const Polygon<T>& rhs)
+template <Scalar T, size_t InlineCapacity>
+std::ostream& operator<<(std::ostream& ostream, const Polygon<T, InlineCapacity>& rhs)
 {
     if (rhs.vertices_.empty())
     {
@@ -112,9 +199,9 @@ std::ostream& operator<<(std::ostream& ostream, const Polygon<T>& rhs)
 
     for (size_t i = 0; i < rhs.vertices_.size() - 1; ++i)
     {
-        ostream << *rhs.vertices_[i] << ' ';
+        ostream << rhs.vertices_[i] << ' ';
     }
-    ostream << *rhs.vertices_[rhs.vertices_.size() - 1];
+    ostream << rhs.vertices_[rhs.vertices_.size() - 1];
 
     return ostream;
 }
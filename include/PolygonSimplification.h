@@ -0,0 +1,261 @@
+#ifndef POLYGONSIMPLIFICATION_H
+#define POLYGONSIMPLIFICATION_H
+
+#include "FigureTraits.h"
+#include "Parallel.h"
+#include "Polygon.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// DouglasPeucker: tolerance is the maximum distance from a dropped vertex to the kept outline.
+// Visvalingam: tolerance is the smallest triangle area a vertex must span to be kept.
+// AreaBounded: tolerance bounds the area of the symmetric difference with the input.
+enum class SimplificationMethod {
+    DouglasPeucker,
+    Visvalingam,
+    AreaBounded
+};
+
+template <Scalar T, size_t InlineCapacity>
+Polygon<T, InlineCapacity> simplify(const Polygon<T, InlineCapacity>& polygon, double tolerance,
+                                    SimplificationMethod method = SimplificationMethod::Visvalingam);
+
+namespace detail {
+
+// Result of simplifying an element of `Polygons`: the Polygon base of the (dereferenced) element.
+template <typename Polygons>
+using SimplifiedPolygon = decltype(simplify(asFigure(*std::ranges::begin(std::declval<const Polygons&>())), 0.0));
+
+} // namespace detail
+
+// Accepts any random-access range of polygons, or of pointers to them (Rectangle, Trapezoid, shared_ptr<Polygon>, ...).
+template <std::ranges::random_access_range Polygons>
+std::vector<detail::SimplifiedPolygon<Polygons>> simplifyAll(const Polygons& polygons, double tolerance,
+                                                             SimplificationMethod method = SimplificationMethod::Visvalingam);
+
+namespace detail {
+
+template <Scalar T>
+double triangleArea(const Point<T>& a, const Point<T>& b, const Point<T>& c)
+{
+    double cross = (static_cast<double>(b.x) - a.x) * (static_cast<double>(c.y) - a.y)
+                 - (static_cast<double>(c.x) - a.x) * (static_cast<double>(b.y) - a.y);
+    return std::abs(cross) / 2;
+}
+
+template <Scalar T>
+double distanceToSegment(const Point<T>& point, const Point<T>& a, const Point<T>& b)
+{
+    double dx = static_cast<double>(b.x) - a.x;
+    double dy = static_cast<double>(b.y) - a.y;
+    double px = static_cast<double>(point.x) - a.x;
+    double py = static_cast<double>(point.y) - a.y;
+    double lengthSquared = dx * dx + dy * dy;
+    if (lengthSquared == 0)
+    {
+        return std::hypot(px, py);
+    }
+
+    double t = std::clamp((px * dx + py * dy) / lengthSquared, 0.0, 1.0);
+    return std::hypot(px - t * dx, py - t * dy);
+}
+
+template <Scalar T>
+std::vector<Point<T>> douglasPeucker(std::span<const Point<T>> vertices, double tolerance)
+{
+    const size_t n = vertices.size();
+    std::vector<bool> keep(n, false);
+
+    size_t farthest = n / 2;
+    double farthestDistance = -1;
+    for (size_t i = 1; i < n; ++i)
+    {
+        double distance = distanceToSegment(vertices[i], vertices[0], vertices[0]);
+        if (distance > farthestDistance)
+        {
+            farthest = i;
+            farthestDistance = distance;
+        }
+    }
+    keep[0] = true;
+    keep[farthest] = true;
+    size_t kept = 2;
+
+    // Index n stands for vertex 0 closing the ring; an explicit stack keeps deep inputs off the call stack.
+    std::vector<std::pair<size_t, size_t>> segments = {{farthest, n}, {0, farthest}};
+    while (!segments.empty())
+    {
+        auto [first, last] = segments.back();
+        segments.pop_back();
+        if (last - first < 2)
+        {
+            continue;
+        }
+
+        size_t split = first + 1;
+        double splitDistance = -1;
+        for (size_t i = first + 1; i < last; ++i)
+        {
+            double distance = distanceToSegment(vertices[i], vertices[first], vertices[last % n]);
+            if (distance > splitDistance)
+            {
+                split = i;
+                splitDistance = distance;
+            }
+        }
+
+        if (splitDistance > tolerance || kept < 3)
+        {
+            keep[split] = true;
+            ++kept;
+            segments.emplace_back(split, last);
+            segments.emplace_back(first, split);
+        }
+    }
+
+    std::vector<Point<T>> result;
+    result.reserve(kept);
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (keep[i])
+        {
+            result.push_back(vertices[i]);
+        }
+    }
+    return result;
+}
+
+template <Scalar T>
+std::vector<Point<T>> visvalingam(std::span<const Point<T>> vertices, double tolerance, bool boundTotalArea)
+{
+    struct Candidate {
+        double area;
+        size_t index;
+        uint32_t version;
+
+        bool operator>(const Candidate& rhs) const
+        {
+            return area > rhs.area;
+        }
+    };
+
+    const size_t n = vertices.size();
+    std::vector<size_t> prev(n);
+    std::vector<size_t> next(n);
+    std::vector<uint32_t> versions(n, 0);
+    std::vector<bool> removed(n, false);
+
+    std::vector<Candidate> candidates;
+    candidates.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        prev[i] = (i + n - 1) % n;
+        next[i] = (i + 1) % n;
+        candidates.push_back({triangleArea(vertices[prev[i]], vertices[i], vertices[next[i]]), i, 0});
+    }
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> heap(std::greater<>(), std::move(candidates));
+
+    size_t remaining = n;
+    double areaError = 0;
+    while (remaining > 3 && !heap.empty())
+    {
+        Candidate candidate = heap.top();
+        if (removed[candidate.index] || candidate.version != versions[candidate.index])
+        {
+            heap.pop();
+            continue;
+        }
+
+        // Removing a vertex changes the outline by exactly its triangle, so the running sum bounds the total error.
+        if (boundTotalArea ? areaError + candidate.area > tolerance : candidate.area >= tolerance)
+        {
+            break;
+        }
+        heap.pop();
+
+        areaError += candidate.area;
+        removed[candidate.index] = true;
+        --remaining;
+
+        size_t before = prev[candidate.index];
+        size_t after = next[candidate.index];
+        next[before] = after;
+        prev[after] = before;
+        for (size_t neighbour : {before, after})
+        {
+            heap.push({triangleArea(vertices[prev[neighbour]], vertices[neighbour], vertices[next[neighbour]]),
+                       neighbour, ++versions[neighbour]});
+        }
+    }
+
+    std::vector<Point<T>> result;
+    result.reserve(remaining);
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (!removed[i])
+        {
+            result.push_back(vertices[i]);
+        }
+    }
+    return result;
+}
+
+} // namespace detail
+
+template <Scalar T, size_t InlineCapacity>
+Polygon<T, InlineCapacity> simplify(const Polygon<T, InlineCapacity>& polygon, double tolerance, SimplificationMethod method)
+{
+    if (!(tolerance >= 0))
+    {
+        throw std::invalid_argument("tolerance must be non-negative");
+    }
+
+    auto vertices = polygon.vertices();
+    if (vertices.size() <= 3)
+    {
+        return polygon;
+    }
+
+    switch (method)
+    {
+        case SimplificationMethod::DouglasPeucker:
+            return Polygon<T, InlineCapacity>(detail::douglasPeucker(vertices, tolerance));
+        case SimplificationMethod::Visvalingam:
+            return Polygon<T, InlineCapacity>(detail::visvalingam(vertices, tolerance, false));
+        case SimplificationMethod::AreaBounded:
+            return Polygon<T, InlineCapacity>(detail::visvalingam(vertices, tolerance, true));
+    }
+    throw std::invalid_argument("unknown simplification method");
+}
+
+template <std::ranges::random_access_range Polygons>
+std::vector<detail::SimplifiedPolygon<Polygons>> simplifyAll(const Polygons& polygons, double tolerance,
+                                                             SimplificationMethod method)
+{
+    using Result = detail::SimplifiedPolygon<Polygons>;
+    if (!(tolerance >= 0))
+    {
+        throw std::invalid_argument("tolerance must be non-negative");
+    }
+
+    const size_t size = std::ranges::size(polygons);
+    std::vector<Result> result(size, Result(size_t(0)));
+    parallelFor(size, 64, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            result[i] = simplify(detail::asFigure(std::ranges::begin(polygons)[i]), tolerance, method);
+        }
+    });
+
+    return result;
+}
+
+#endif //POLYGONSIMPLIFICATION_H
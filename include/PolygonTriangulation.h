@@ -0,0 +1,604 @@
+#ifndef POLYGONTRIANGULATION_H
+#define POLYGONTRIANGULATION_H
+
+#include "FigureTraits.h"
+#include "Polygon.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <ranges>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Triangulates simple polygons by sweeping them into y-monotone pieces and
+// triangulating each piece with a stack, O(n log n) overall. Triangles are
+// written counter-clockwise into a caller-provided index buffer. The working
+// arrays and the sweep status arena live in the Triangulator and are reused,
+// so once it has seen its largest polygon a call performs no allocation.
+template <Scalar T>
+class Triangulator {
+private:
+    // uint32_t indices address at most 2^32 vertices, per polygon and per batch.
+    constexpr static size_t maxVertices_ = size_t{std::numeric_limits<uint32_t>::max()} + 1;
+
+    enum class VertexType : uint8_t {
+        Start,
+        End,
+        Split,
+        Merge,
+        Regular
+    };
+
+    struct Vertex {
+        double x;
+        double y;
+    };
+
+    // Orders the edges crossing the sweep line from left to right; a double probes by x.
+    struct EdgeOrder {
+        const Triangulator* owner;
+        using is_transparent = void;
+
+        bool operator()(uint32_t lhs, uint32_t rhs) const
+        {
+            return owner->xAtSweep(lhs) < owner->xAtSweep(rhs);
+        }
+        bool operator()(double lhs, uint32_t rhs) const
+        {
+            return lhs < owner->xAtSweep(rhs);
+        }
+        bool operator()(uint32_t lhs, double rhs) const
+        {
+            return owner->xAtSweep(lhs) < rhs;
+        }
+    };
+
+    using Status = std::pmr::set<uint32_t, EdgeOrder>;
+private:
+    std::vector<Vertex> points_;
+    std::vector<uint32_t> original_;
+    std::vector<uint32_t> events_;
+    std::vector<VertexType> types_;
+    std::vector<uint32_t> helpers_;
+    std::vector<typename Status::iterator> statusPositions_;
+    std::vector<std::pair<uint32_t, uint32_t>> diagonals_;
+    std::vector<uint32_t> adjacencyOffsets_;
+    std::vector<uint32_t> adjacencyCursors_;
+    std::vector<uint32_t> adjacency_;
+    std::vector<bool> visited_;
+    std::vector<uint32_t> piece_;
+    std::vector<std::pair<uint32_t, bool>> sorted_;
+    std::vector<std::pair<uint32_t, bool>> stack_;
+    std::pmr::unsynchronized_pool_resource statusArena_;
+    Status status_;
+    double sweepY_ = 0;
+public:
+    Triangulator();
+public:
+    Triangulator(const Triangulator&) = delete;
+    Triangulator& operator=(const Triangulator&) = delete;
+public:
+    ~Triangulator() noexcept = default;
+public:
+    static size_t indexCount(size_t amountOfVertices) noexcept;
+public:
+    size_t triangulate(std::span<const Point<T>> vertices, std::span<uint32_t> indices);
+    template <size_t InlineCapacity>
+    size_t triangulate(const Polygon<T, InlineCapacity>& polygon, std::span<uint32_t> indices);
+    template <std::ranges::input_range Polygons>
+    size_t triangulateAll(const Polygons& polygons, std::span<uint32_t> indices, std::span<uint32_t> firstTriangles = {});
+private:
+    bool above(uint32_t a, uint32_t b) const;
+    double cross(uint32_t a, uint32_t b, uint32_t c) const;
+    double xAtSweep(uint32_t edge) const;
+    size_t emit(uint32_t a, uint32_t b, uint32_t c, std::span<uint32_t> indices, size_t triangle) const;
+    bool isConvex() const;
+    void classify();
+    void partition();
+    void buildAdjacency();
+    size_t triangulatePieces(std::span<uint32_t> indices);
+    size_t triangulateMonotone(std::span<uint32_t> indices, size_t triangle);
+    void insertEdge(uint32_t edge, uint32_t helper);
+    void eraseEdge(uint32_t edge);
+    uint32_t leftEdgeOf(uint32_t vertex) const;
+    void connectToMergeHelper(uint32_t vertex, uint32_t edge);
+};
+
+template <Scalar T>
+Triangulator<T>::Triangulator() : status_(EdgeOrder{this}, &statusArena_) {}
+
+template <Scalar T>
+size_t Triangulator<T>::indexCount(size_t amountOfVertices) noexcept
+{
+    return amountOfVertices < 3 ? 0 : 3 * (amountOfVertices - 2);
+}
+
+template <Scalar T>
+size_t Triangulator<T>::triangulate(std::span<const Point<T>> vertices, std::span<uint32_t> indices)
+{
+    const size_t n = vertices.size();
+    if (n < 3)
+    {
+        return 0;
+    }
+    if (n > maxVertices_)
+    {
+        throw std::invalid_argument("too many vertices for 32-bit indices");
+    }
+    if (indices.size() < indexCount(n))
+    {
+        throw std::invalid_argument("index buffer too small");
+    }
+
+    double signedArea = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        size_t j = (i + 1) % n;
+        signedArea += static_cast<double>(vertices[i].x) * vertices[j].y - static_cast<double>(vertices[j].x) * vertices[i].y;
+    }
+
+    // Work on a counter-clockwise copy; original_ maps back to the caller's indices.
+    points_.resize(n);
+    original_.resize(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        size_t source = signedArea >= 0 ? i : n - 1 - i;
+        points_[i] = {static_cast<double>(vertices[source].x), static_cast<double>(vertices[source].y)};
+        original_[i] = static_cast<uint32_t>(source);
+    }
+
+    if (n == 3 || isConvex())
+    {
+        for (uint32_t i = 1; i + 1 < n; ++i)
+        {
+            emit(0, i, i + 1, indices, i - 1);
+        }
+        return n - 2;
+    }
+    if (n == 4)
+    {
+        uint32_t reflex = 0;
+        while (reflex < 4 && cross((reflex + 3) % 4, reflex, (reflex + 1) % 4) > 0)
+        {
+            ++reflex;
+        }
+        reflex %= 4;
+        emit(reflex, (reflex + 1) % 4, (reflex + 2) % 4, indices, 0);
+        emit(reflex, (reflex + 2) % 4, (reflex + 3) % 4, indices, 1);
+        return 2;
+    }
+
+    classify();
+    partition();
+    buildAdjacency();
+    return triangulatePieces(indices);
+}
+
+template <Scalar T>
+template <size_t InlineCapacity>
+size_t Triangulator<T>::triangulate(const Polygon<T, InlineCapacity>& polygon, std::span<uint32_t> indices)
+{
+    return triangulate(polygon.vertices(), indices);
+}
+
+// Indices refer to the polygons' vertices concatenated in order. firstTriangles, when
+// given, receives each polygon's first triangle plus a final entry with the total;
+// both fit in uint32_t because a batch never has more triangles than vertices.
+template <Scalar T>
+template <std::ranges::input_range Polygons>
+size_t Triangulator<T>::triangulateAll(const Polygons& polygons, std::span<uint32_t> indices, std::span<uint32_t> firstTriangles)
+{
+    size_t triangles = 0;
+    size_t baseVertex = 0;
+    size_t polygonIndex = 0;
+    for (const auto& item : polygons)
+    {
+        std::span<const Point<T>> vertices = detail::asFigure(item).vertices();
+        if (vertices.size() > maxVertices_ - baseVertex)
+        {
+            throw std::invalid_argument("too many vertices for 32-bit indices");
+        }
+
+        if (polygonIndex < firstTriangles.size())
+        {
+            firstTriangles[polygonIndex] = static_cast<uint32_t>(triangles);
+        }
+        auto output = indices.subspan(std::min(3 * triangles, indices.size()));
+        size_t written = triangulate(vertices, output);
+        for (size_t i = 0; i < 3 * written; ++i)
+        {
+            output[i] += static_cast<uint32_t>(baseVertex);
+        }
+
+        triangles += written;
+        baseVertex += vertices.size();
+        ++polygonIndex;
+    }
+    if (polygonIndex < firstTriangles.size())
+    {
+        firstTriangles[polygonIndex] = static_cast<uint32_t>(triangles);
+    }
+    return triangles;
+}
+
+template <Scalar T>
+bool Triangulator<T>::above(uint32_t a, uint32_t b) const
+{
+    return points_[a].y > points_[b].y || (points_[a].y == points_[b].y && points_[a].x < points_[b].x);
+}
+
+template <Scalar T>
+double Triangulator<T>::cross(uint32_t a, uint32_t b, uint32_t c) const
+{
+    return (points_[b].x - points_[a].x) * (points_[c].y - points_[b].y)
+         - (points_[b].y - points_[a].y) * (points_[c].x - points_[b].x);
+}
+
+template <Scalar T>
+double Triangulator<T>::xAtSweep(uint32_t edge) const
+{
+    const Vertex& a = points_[edge];
+    const Vertex& b = points_[(edge + 1) % points_.size()];
+    // A horizontal edge is only in the status between its own two endpoint events.
+    if (a.y == b.y)
+    {
+        return std::min(a.x, b.x);
+    }
+    return a.x + (sweepY_ - a.y) / (b.y - a.y) * (b.x - a.x);
+}
+
+template <Scalar T>
+size_t Triangulator<T>::emit(uint32_t a, uint32_t b, uint32_t c, std::span<uint32_t> indices, size_t triangle) const
+{
+    if (cross(a, b, c) < 0)
+    {
+        std::swap(b, c);
+    }
+    indices[3 * triangle] = original_[a];
+    indices[3 * triangle + 1] = original_[b];
+    indices[3 * triangle + 2] = original_[c];
+    return triangle + 1;
+}
+
+// Every turn is a left turn and the outline changes vertical direction only twice,
+// so it winds around once: a convex polygon that fans from vertex 0.
+template <Scalar T>
+bool Triangulator<T>::isConvex() const
+{
+    const size_t n = points_.size();
+    size_t directionChanges = 0;
+    int lastDirection = 0;
+    for (size_t i = 0; i < n + 1; ++i)
+    {
+        uint32_t a = static_cast<uint32_t>(i % n);
+        uint32_t b = static_cast<uint32_t>((i + 1) % n);
+        uint32_t c = static_cast<uint32_t>((i + 2) % n);
+        if (i < n && cross(a, b, c) < 0)
+        {
+            return false;
+        }
+
+        int direction = above(b, a) ? 1 : -1;
+        if (lastDirection != 0 && direction != lastDirection)
+        {
+            ++directionChanges;
+        }
+        lastDirection = direction;
+    }
+    return directionChanges <= 2;
+}
+
+template <Scalar T>
+void Triangulator<T>::classify()
+{
+    const uint32_t n = static_cast<uint32_t>(points_.size());
+    types_.resize(n);
+    events_.resize(n);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        uint32_t prev = (i + n - 1) % n;
+        uint32_t next = (i + 1) % n;
+        bool convex = cross(prev, i, next) > 0;
+        if (above(i, prev) && above(i, next))
+        {
+            types_[i] = convex ? VertexType::Start : VertexType::Split;
+        }
+        else if (above(prev, i) && above(next, i))
+        {
+            types_[i] = convex ? VertexType::End : VertexType::Merge;
+        }
+        else
+        {
+            types_[i] = VertexType::Regular;
+        }
+        events_[i] = i;
+    }
+    std::sort(events_.begin(), events_.end(), [this](uint32_t a, uint32_t b) { return above(a, b); });
+}
+
+template <Scalar T>
+void Triangulator<T>::insertEdge(uint32_t edge, uint32_t helper)
+{
+    helpers_[edge] = helper;
+    statusPositions_[edge] = status_.insert(edge).first;
+}
+
+template <Scalar T>
+void Triangulator<T>::eraseEdge(uint32_t edge)
+{
+    status_.erase(statusPositions_[edge]);
+}
+
+template <Scalar T>
+uint32_t Triangulator<T>::leftEdgeOf(uint32_t vertex) const
+{
+    auto it = status_.upper_bound(points_[vertex].x);
+    if (it == status_.begin())
+    {
+        throw std::invalid_argument("polygon is not simple");
+    }
+    return *std::prev(it);
+}
+
+template <Scalar T>
+void Triangulator<T>::connectToMergeHelper(uint32_t vertex, uint32_t edge)
+{
+    if (types_[helpers_[edge]] == VertexType::Merge)
+    {
+        diagonals_.emplace_back(vertex, helpers_[edge]);
+    }
+}
+
+// Sweeps top to bottom and adds the diagonals that cut the polygon into y-monotone pieces.
+template <Scalar T>
+void Triangulator<T>::partition()
+{
+    const uint32_t n = static_cast<uint32_t>(points_.size());
+    helpers_.resize(n);
+    statusPositions_.resize(n);
+    diagonals_.clear();
+    status_.clear();
+
+    for (uint32_t vertex : events_)
+    {
+        sweepY_ = points_[vertex].y;
+        uint32_t prevEdge = (vertex + n - 1) % n;
+        switch (types_[vertex])
+        {
+            case VertexType::Start:
+                insertEdge(vertex, vertex);
+                break;
+            case VertexType::End:
+                connectToMergeHelper(vertex, prevEdge);
+                eraseEdge(prevEdge);
+                break;
+            case VertexType::Split:
+            {
+                uint32_t left = leftEdgeOf(vertex);
+                diagonals_.emplace_back(vertex, helpers_[left]);
+                helpers_[left] = vertex;
+                insertEdge(vertex, vertex);
+                break;
+            }
+            case VertexType::Merge:
+            {
+                connectToMergeHelper(vertex, prevEdge);
+                eraseEdge(prevEdge);
+                uint32_t left = leftEdgeOf(vertex);
+                connectToMergeHelper(vertex, left);
+                helpers_[left] = vertex;
+                break;
+            }
+            case VertexType::Regular:
+                if (above(prevEdge, vertex))
+                {
+                    connectToMergeHelper(vertex, prevEdge);
+                    eraseEdge(prevEdge);
+                    insertEdge(vertex, vertex);
+                }
+                else
+                {
+                    uint32_t left = leftEdgeOf(vertex);
+                    connectToMergeHelper(vertex, left);
+                    helpers_[left] = vertex;
+                }
+                break;
+        }
+    }
+    status_.clear();
+}
+
+// Builds each vertex's neighbours (outline successor, predecessor and diagonals) sorted by angle.
+template <Scalar T>
+void Triangulator<T>::buildAdjacency()
+{
+    const uint32_t n = static_cast<uint32_t>(points_.size());
+    adjacencyOffsets_.assign(n + 1, 2);
+    adjacencyOffsets_[n] = 0;
+    for (auto [a, b] : diagonals_)
+    {
+        ++adjacencyOffsets_[a];
+        ++adjacencyOffsets_[b];
+    }
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i <= n; ++i)
+    {
+        uint32_t degree = adjacencyOffsets_[i];
+        adjacencyOffsets_[i] = offset;
+        offset += degree;
+    }
+
+    adjacency_.resize(offset);
+    visited_.assign(offset, false);
+    adjacencyCursors_.assign(adjacencyOffsets_.begin(), adjacencyOffsets_.end() - 1);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        adjacency_[adjacencyCursors_[i]++] = (i + 1) % n;
+        adjacency_[adjacencyCursors_[i]++] = (i + n - 1) % n;
+    }
+    for (auto [a, b] : diagonals_)
+    {
+        adjacency_[adjacencyCursors_[a]++] = b;
+        adjacency_[adjacencyCursors_[b]++] = a;
+    }
+
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        auto begin = adjacency_.begin() + adjacencyOffsets_[i];
+        auto end = adjacency_.begin() + adjacencyOffsets_[i + 1];
+        if (end - begin > 2)
+        {
+            std::sort(begin, end, [this, i](uint32_t a, uint32_t b) {
+                return std::atan2(points_[a].y - points_[i].y, points_[a].x - points_[i].x)
+                     < std::atan2(points_[b].y - points_[i].y, points_[b].x - points_[i].x);
+            });
+        }
+    }
+}
+
+// Walks every interior face of the outline plus diagonals; each face is a monotone piece.
+template <Scalar T>
+size_t Triangulator<T>::triangulatePieces(std::span<uint32_t> indices)
+{
+    const uint32_t n = static_cast<uint32_t>(points_.size());
+    auto slotOf = [this](uint32_t from, uint32_t to) {
+        uint32_t slot = adjacencyOffsets_[from];
+        while (adjacency_[slot] != to)
+        {
+            ++slot;
+        }
+        return slot;
+    };
+
+    size_t triangle = 0;
+    for (uint32_t start = 0; start < n; ++start)
+    {
+        for (uint32_t startSlot = adjacencyOffsets_[start]; startSlot < adjacencyOffsets_[start + 1]; ++startSlot)
+        {
+            // Half-edges running backwards along the outline belong to the exterior face.
+            if (visited_[startSlot] || adjacency_[startSlot] == (start + n - 1) % n)
+            {
+                continue;
+            }
+
+            piece_.clear();
+            uint32_t from = start;
+            uint32_t slot = startSlot;
+            while (!visited_[slot])
+            {
+                visited_[slot] = true;
+                piece_.push_back(from);
+                uint32_t to = adjacency_[slot];
+
+                // The next half-edge of the face is the first one clockwise from the way back.
+                uint32_t back = slotOf(to, from);
+                slot = back == adjacencyOffsets_[to] ? adjacencyOffsets_[to + 1] - 1 : back - 1;
+                from = to;
+            }
+            triangle = triangulateMonotone(indices, triangle);
+        }
+    }
+    return triangle;
+}
+
+// Triangulates the y-monotone piece in piece_ (counter-clockwise) with the classic stack sweep.
+template <Scalar T>
+size_t Triangulator<T>::triangulateMonotone(std::span<uint32_t> indices, size_t triangle)
+{
+    const size_t m = piece_.size();
+    if (m < 3)
+    {
+        return triangle;
+    }
+    if (m == 3)
+    {
+        return emit(piece_[0], piece_[1], piece_[2], indices, triangle);
+    }
+
+    size_t top = 0;
+    size_t bottom = 0;
+    for (size_t i = 1; i < m; ++i)
+    {
+        if (above(piece_[i], piece_[top]))
+        {
+            top = i;
+        }
+        if (above(piece_[bottom], piece_[i]))
+        {
+            bottom = i;
+        }
+    }
+
+    // Counter-clockwise from the top runs down the left chain; clockwise runs down the right one.
+    sorted_.clear();
+    size_t left = (top + 1) % m;
+    size_t right = (top + m - 1) % m;
+    sorted_.emplace_back(piece_[top], true);
+    while (sorted_.size() < m - 1)
+    {
+        bool takeLeft = left != bottom && (right == bottom || above(piece_[left], piece_[right]));
+        if (takeLeft)
+        {
+            sorted_.emplace_back(piece_[left], true);
+            left = (left + 1) % m;
+        }
+        else
+        {
+            sorted_.emplace_back(piece_[right], false);
+            right = (right + m - 1) % m;
+        }
+    }
+    sorted_.emplace_back(piece_[bottom], true);
+
+    stack_.clear();
+    stack_.push_back(sorted_[0]);
+    stack_.push_back(sorted_[1]);
+    for (size_t j = 2; j + 1 < m; ++j)
+    {
+        auto current = sorted_[j];
+        if (current.second != stack_.back().second)
+        {
+            for (size_t k = stack_.size() - 1; k > 0; --k)
+            {
+                triangle = emit(current.first, stack_[k].first, stack_[k - 1].first, indices, triangle);
+            }
+            stack_.clear();
+            stack_.push_back(sorted_[j - 1]);
+            stack_.push_back(current);
+        }
+        else
+        {
+            auto last = stack_.back();
+            stack_.pop_back();
+            while (!stack_.empty())
+            {
+                auto candidate = stack_.back();
+                double turn = current.second ? cross(candidate.first, last.first, current.first)
+                                             : cross(current.first, last.first, candidate.first);
+                if (turn <= 0)
+                {
+                    break;
+                }
+                triangle = emit(current.first, last.first, candidate.first, indices, triangle);
+                last = candidate;
+                stack_.pop_back();
+            }
+            stack_.push_back(last);
+            stack_.push_back(current);
+        }
+    }
+
+    uint32_t last = sorted_[m - 1].first;
+    for (size_t k = stack_.size() - 1; k > 0; --k)
+    {
+        triangle = emit(last, stack_[k].first, stack_[k - 1].first, indices, triangle);
+    }
+    return triangle;
+}
+
+#endif //POLYGONTRIANGULATION_H
@@ -4,7 +4,7 @@
 #include <Polygon.h>
 
 template <Scalar T>
-class Rectangle : public Polygon<T> {
+class Rectangle : public Polygon<T, 4> {
 private:
     constexpr static size_t amountOfVertices_ = 4;
 public:
@@ -21,10 +21,10 @@ public:
 };
 
 template <Scalar T>
-Rectangle<T>::Rectangle() : Polygon<T>(amountOfVertices_) {}
+Rectangle<T>::Rectangle() : Polygon<T, 4>(amountOfVertices_) {}
 
 template <Scalar T>
-Rectangle<T>::Rectangle(const std::initializer_list<Point<T>>& points) : Polygon<T>(points)
+Rectangle<T>::Rectangle(const std::initializer_list<Point<T>>& points) : Polygon<T, 4>(points)
 {
     if (points.size() != amountOfVertices_)
     {
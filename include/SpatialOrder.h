@@ -0,0 +1,345 @@
+#ifndef SPATIALORDER_H
+#define SPATIALORDER_H
+
+#include "FigureQueries.h"
+#include "Parallel.h"
+#include "Point.h"
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+enum class SpaceFillingCurve {
+    Morton,
+    Hilbert
+};
+
+// Orders a figure collection along a space-filling curve through the figures' geometric
+// centers. Centers are quantized onto a 2^32 x 2^32 grid over their bounding box.
+// Position i of the curve order holds figure order()[i]; apply() permutes collections
+// (or several parallel columns) into that order. The sorted keys double as a spatial
+// index: queryBox() returns curve positions, which are collection indices after apply().
+// Box edges are resolved on the quantization grid. Figures with a NaN or infinite center
+// are rejected with std::invalid_argument.
+class SpatialOrder {
+private:
+    struct Cell {
+        uint64_t x;
+        uint64_t y;
+        unsigned level;
+    };
+private:
+    SpaceFillingCurve curve_;
+    double minX_ = 0;
+    double minY_ = 0;
+    double maxX_ = 0;
+    double maxY_ = 0;
+    double scaleX_ = 0;
+    double scaleY_ = 0;
+    std::vector<uint64_t> keys_;
+    std::vector<size_t> order_;
+public:
+    template <std::ranges::random_access_range Figures>
+    explicit SpatialOrder(const Figures& figures, SpaceFillingCurve curve = SpaceFillingCurve::Hilbert);
+public:
+    SpaceFillingCurve curve() const noexcept;
+    std::span<const uint64_t> keys() const noexcept;
+    std::span<const size_t> order() const noexcept;
+public:
+    template <typename... Columns>
+    void apply(std::vector<Columns>&... columns) const;
+    std::vector<size_t> queryBox(const Point<double>& min, const Point<double>& max) const;
+public:
+    static uint64_t mortonKey(uint32_t x, uint32_t y) noexcept;
+    static std::pair<uint32_t, uint32_t> mortonPoint(uint64_t key) noexcept;
+    static uint64_t hilbertKey(uint32_t x, uint32_t y) noexcept;
+    static std::pair<uint32_t, uint32_t> hilbertPoint(uint64_t key) noexcept;
+private:
+    uint64_t keyOf(uint32_t x, uint32_t y) const noexcept;
+    std::pair<uint32_t, uint32_t> pointOf(uint64_t key) const noexcept;
+    static uint32_t quantize(double value, double min, double scale) noexcept;
+    template <typename Column>
+    void permute(std::vector<Column>& column) const;
+};
+
+template <std::ranges::random_access_range Figures>
+SpatialOrder::SpatialOrder(const Figures& figures, SpaceFillingCurve curve) : curve_(curve)
+{
+    // One virtual calcGeometricCenter() call per figure yields both coordinates.
+    const size_t size = std::ranges::size(figures);
+    if (size == 0)
+    {
+        return;
+    }
+    std::vector<double> xs(size);
+    std::vector<double> ys(size);
+    parallelFor(size, 16384, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            auto center = detail::asFigure(std::ranges::begin(figures)[i]).calcGeometricCenter();
+            xs[i] = static_cast<double>(center.x);
+            ys[i] = static_cast<double>(center.y);
+        }
+    });
+
+    // A NaN or infinite center would poison the bounds and has no cell on the grid.
+    minX_ = maxX_ = xs[0];
+    minY_ = maxY_ = ys[0];
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (!std::isfinite(xs[i]) || !std::isfinite(ys[i]))
+        {
+            throw std::invalid_argument("figure with a non-finite center");
+        }
+        minX_ = std::min(minX_, xs[i]);
+        maxX_ = std::max(maxX_, xs[i]);
+        minY_ = std::min(minY_, ys[i]);
+        maxY_ = std::max(maxY_, ys[i]);
+    }
+    constexpr double gridMax = std::numeric_limits<uint32_t>::max();
+    scaleX_ = maxX_ > minX_ ? gridMax / (maxX_ - minX_) : 0;
+    scaleY_ = maxY_ > minY_ ? gridMax / (maxY_ - minY_) : 0;
+
+    std::vector<uint64_t> keys(xs.size());
+    parallelFor(keys.size(), 16384, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            keys[i] = keyOf(quantize(xs[i], minX_, scaleX_), quantize(ys[i], minY_, scaleY_));
+        }
+    });
+
+    order_ = radixSortIndices(keys);
+    keys_.resize(keys.size());
+    parallelFor(keys.size(), 16384, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            keys_[i] = keys[order_[i]];
+        }
+    });
+}
+
+inline SpaceFillingCurve SpatialOrder::curve() const noexcept
+{
+    return curve_;
+}
+
+inline std::span<const uint64_t> SpatialOrder::keys() const noexcept
+{
+    return keys_;
+}
+
+inline std::span<const size_t> SpatialOrder::order() const noexcept
+{
+    return order_;
+}
+
+template <typename... Columns>
+void SpatialOrder::apply(std::vector<Columns>&... columns) const
+{
+    if (((columns.size() != order_.size()) || ...))
+    {
+        throw std::invalid_argument("column size does not match the spatial order");
+    }
+    (permute(columns), ...);
+}
+
+template <typename Column>
+void SpatialOrder::permute(std::vector<Column>& column) const
+{
+    std::vector<Column> reordered;
+    if constexpr (std::default_initializable<Column>)
+    {
+        reordered.resize(column.size());
+        parallelFor(column.size(), 16384, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                reordered[i] = std::move(column[order_[i]]);
+            }
+        });
+    }
+    else
+    {
+        reordered.reserve(column.size());
+        for (size_t index : order_)
+        {
+            reordered.push_back(std::move(column[index]));
+        }
+    }
+    column.swap(reordered);
+}
+
+// Aligned quadtree cells cover contiguous key ranges on both curves, so the box is
+// decomposed into cells: inner cells are taken whole, boundary cells are filtered.
+inline std::vector<size_t> SpatialOrder::queryBox(const Point<double>& min, const Point<double>& max) const
+{
+    std::vector<size_t> result;
+    if (keys_.empty() || !(min.x <= max.x) || !(min.y <= max.y))
+    {
+        return result;
+    }
+    // Quantization clamps onto the grid, so a box missing the centers' bounds must be rejected up front.
+    if (max.x < minX_ || min.x > maxX_ || max.y < minY_ || min.y > maxY_)
+    {
+        return result;
+    }
+
+    const uint64_t boxX0 = quantize(min.x, minX_, scaleX_);
+    const uint64_t boxY0 = quantize(min.y, minY_, scaleY_);
+    const uint64_t boxX1 = quantize(max.x, minX_, scaleX_);
+    const uint64_t boxY1 = quantize(max.y, minY_, scaleY_);
+    const uint64_t extent = std::max(boxX1 - boxX0, boxY1 - boxY0) + 1;
+
+    auto collect = [&](uint64_t first, uint64_t last, bool filter) {
+        for (auto it = std::lower_bound(keys_.begin(), keys_.end(), first); it != keys_.end() && *it <= last; ++it)
+        {
+            if (filter)
+            {
+                auto [x, y] = pointOf(*it);
+                if (x < boxX0 || x > boxX1 || y < boxY0 || y > boxY1)
+                {
+                    continue;
+                }
+            }
+            result.push_back(static_cast<size_t>(it - keys_.begin()));
+        }
+    };
+
+    std::vector<Cell> cells = {{0, 0, 32}};
+    while (!cells.empty())
+    {
+        Cell cell = cells.back();
+        cells.pop_back();
+
+        const uint64_t side = uint64_t(1) << cell.level;
+        const uint64_t cellX1 = cell.x + side - 1;
+        const uint64_t cellY1 = cell.y + side - 1;
+        if (cellX1 < boxX0 || cell.x > boxX1 || cellY1 < boxY0 || cell.y > boxY1)
+        {
+            continue;
+        }
+
+        uint64_t first = 0;
+        uint64_t last = std::numeric_limits<uint64_t>::max();
+        if (cell.level < 32)
+        {
+            unsigned shift = 2 * cell.level;
+            first = keyOf(static_cast<uint32_t>(cell.x), static_cast<uint32_t>(cell.y)) >> shift << shift;
+            last = first + ((uint64_t(1) << shift) - 1);
+        }
+
+        bool inside = cell.x >= boxX0 && cellX1 <= boxX1 && cell.y >= boxY0 && cellY1 <= boxY1;
+        if (inside || cell.level == 0 || side * 8 <= extent)
+        {
+            collect(first, last, !inside);
+            continue;
+        }
+
+        uint64_t half = side / 2;
+        for (uint64_t dy : {uint64_t(0), half})
+        {
+            for (uint64_t dx : {uint64_t(0), half})
+            {
+                cells.push_back({cell.x + dx, cell.y + dy, cell.level - 1});
+            }
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+inline uint64_t SpatialOrder::mortonKey(uint32_t x, uint32_t y) noexcept
+{
+    auto spread = [](uint64_t v) {
+        v = (v | (v << 16)) & 0x0000FFFF0000FFFFull;
+        v = (v | (v << 8)) & 0x00FF00FF00FF00FFull;
+        v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0Full;
+        v = (v | (v << 2)) & 0x3333333333333333ull;
+        v = (v | (v << 1)) & 0x5555555555555555ull;
+        return v;
+    };
+    return spread(x) | (spread(y) << 1);
+}
+
+inline std::pair<uint32_t, uint32_t> SpatialOrder::mortonPoint(uint64_t key) noexcept
+{
+    auto compact = [](uint64_t v) {
+        v &= 0x5555555555555555ull;
+        v = (v | (v >> 1)) & 0x3333333333333333ull;
+        v = (v | (v >> 2)) & 0x0F0F0F0F0F0F0F0Full;
+        v = (v | (v >> 4)) & 0x00FF00FF00FF00FFull;
+        v = (v | (v >> 8)) & 0x0000FFFF0000FFFFull;
+        v = (v | (v >> 16)) & 0x00000000FFFFFFFFull;
+        return static_cast<uint32_t>(v);
+    };
+    return {compact(key), compact(key >> 1)};
+}
+
+inline uint64_t SpatialOrder::hilbertKey(uint32_t x, uint32_t y) noexcept
+{
+    uint64_t key = 0;
+    for (uint32_t s = uint32_t(1) << 31; s > 0; s >>= 1)
+    {
+        uint32_t rx = (x & s) ? 1 : 0;
+        uint32_t ry = (y & s) ? 1 : 0;
+        key += uint64_t(s) * s * ((3 * rx) ^ ry);
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = ~x;
+                y = ~y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return key;
+}
+
+inline std::pair<uint32_t, uint32_t> SpatialOrder::hilbertPoint(uint64_t key) noexcept
+{
+    uint32_t x = 0;
+    uint32_t y = 0;
+    for (uint64_t s = 1; s < (uint64_t(1) << 32); s <<= 1)
+    {
+        uint32_t rx = 1 & static_cast<uint32_t>(key / 2);
+        uint32_t ry = 1 & static_cast<uint32_t>(key ^ rx);
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = static_cast<uint32_t>(s - 1 - x);
+                y = static_cast<uint32_t>(s - 1 - y);
+            }
+            std::swap(x, y);
+        }
+        x += static_cast<uint32_t>(s * rx);
+        y += static_cast<uint32_t>(s * ry);
+        key /= 4;
+    }
+    return {x, y};
+}
+
+inline uint64_t SpatialOrder::keyOf(uint32_t x, uint32_t y) const noexcept
+{
+    return curve_ == SpaceFillingCurve::Morton ? mortonKey(x, y) : hilbertKey(x, y);
+}
+
+inline std::pair<uint32_t, uint32_t> SpatialOrder::pointOf(uint64_t key) const noexcept
+{
+    return curve_ == SpaceFillingCurve::Morton ? mortonPoint(key) : hilbertPoint(key);
+}
+
+inline uint32_t SpatialOrder::quantize(double value, double min, double scale) noexcept
+{
+    constexpr double gridMax = std::numeric_limits<uint32_t>::max();
+    return static_cast<uint32_t>(std::clamp((value - min) * scale, 0.0, gridMax));
+}
+
+#endif //SPATIALORDER_H
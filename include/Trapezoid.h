@@ -4,7 +4,7 @@
 #include "Polygon.h"
 
 template <Scalar T>
-class Trapezoid final: public Polygon<T> {
+class Trapezoid final: public Polygon<T, 4> {
 private:
     constexpr static size_t amountOfVertices_ = 4;
 public:
@@ -21,10 +21,10 @@ public:
 };
 
 template <Scalar T>
-Trapezoid<T>::Trapezoid() : Polygon<T>(amountOfVertices_) {}
+Trapezoid<T>::Trapezoid() : Polygon<T, 4>(amountOfVertices_) {}
 
 template <Scalar T>
-Trapezoid<T>::Trapezoid(const std::initializer_list<Point<T>>& points) : Polygon<T>(points)
+Trapezoid<T>::Trapezoid(const std::initializer_list<Point<T>>& points) : Polygon<T, 4>(points)
 {
     if (points.size() != amountOfVertices_)
     {
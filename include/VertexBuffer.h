@@ -0,0 +1,266 @@
+#ifndef VERTEXBUFFER_H
+#define VERTEXBUFFER_H
+
+#include "Point.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+// Vertex storage that keeps up to InlineCapacity points inline and spills larger
+// sets into an immutable, reference-counted heap buffer with copy-on-write.
+// The inline array and the heap pointer share storage, as in a small vector;
+// inlineSize_ holds heapTag_ while the heap pointer is the active member.
+// Copies of a spilled buffer share it; a writer detaches only when it is shared.
+// Concurrent reads of a shared buffer are safe: readers only touch the const
+// vector and the atomic reference count. A writer that finds itself the sole
+// owner issues an acquire fence, so reads made through copies released by other
+// threads happen before its in-place writes.
+template <Scalar T, size_t InlineCapacity = 8>
+class VertexBuffer {
+private:
+    constexpr static size_t heapTag_ = std::numeric_limits<size_t>::max();
+    union {
+        std::array<Point<T>, InlineCapacity> inline_;
+        std::shared_ptr<const std::vector<Point<T>>> heap_;
+    };
+    size_t inlineSize_ = 0;
+public:
+    VertexBuffer() noexcept;
+    explicit VertexBuffer(size_t size);
+    VertexBuffer(const std::initializer_list<Point<T>>& points);
+    explicit VertexBuffer(std::vector<Point<T>> points);
+public:
+    VertexBuffer(const VertexBuffer& rhs) noexcept;
+    VertexBuffer& operator=(const VertexBuffer& rhs) noexcept;
+public:
+    VertexBuffer(VertexBuffer&& rhs) noexcept;
+    VertexBuffer& operator=(VertexBuffer&& rhs) noexcept;
+public:
+    ~VertexBuffer() noexcept;
+public:
+    constexpr static size_t inlineCapacity() noexcept;
+    size_t size() const noexcept;
+    bool empty() const noexcept;
+    bool isInline() const noexcept;
+    bool isShared() const noexcept;
+public:
+    const Point<T>& operator[](size_t index) const;
+    std::span<const Point<T>> view() const noexcept;
+public:
+    Point<T>& mutableAt(size_t index);
+    std::span<Point<T>> mutableView();
+private:
+    std::vector<Point<T>>& detach();
+    void destroy() noexcept;
+};
+
+template <Scalar T, size_t InlineCapacity>
+VertexBuffer<T, InlineCapacity>::VertexBuffer() noexcept
+{
+    std::construct_at(&inline_);
+}
+
+template <Scalar T, size_t InlineCapacity>
+VertexBuffer<T, InlineCapacity>::VertexBuffer(size_t size)
+{
+    if (size <= InlineCapacity)
+    {
+        std::construct_at(&inline_);
+        inlineSize_ = size;
+    }
+    else
+    {
+        std::construct_at(&heap_, std::make_shared<std::vector<Point<T>>>(size));
+        inlineSize_ = heapTag_;
+    }
+}
+
+template <Scalar T, size_t InlineCapacity>
+VertexBuffer<T, InlineCapacity>::VertexBuffer(const std::initializer_list<Point<T>>& points)
+{
+    if (points.size() <= InlineCapacity)
+    {
+        std::construct_at(&inline_);
+        std::copy(points.begin(), points.end(), inline_.begin());
+        inlineSize_ = points.size();
+    }
+    else
+    {
+        std::construct_at(&heap_, std::make_shared<std::vector<Point<T>>>(points));
+        inlineSize_ = heapTag_;
+    }
+}
+
+template <Scalar T, size_t InlineCapacity>
+VertexBuffer<T, InlineCapacity>::VertexBuffer(std::vector<Point<T>> points)
+{
+    if (points.size() <= InlineCapacity)
+    {
+        std::construct_at(&inline_);
+        std::copy(points.begin(), points.end(), inline_.begin());
+        inlineSize_ = points.size();
+    }
+    else
+    {
+        std::construct_at(&heap_, std::make_shared<std::vector<Point<T>>>(std::move(points)));
+        inlineSize_ = heapTag_;
+    }
+}
+
+template <Scalar T, size_t InlineCapacity>
+VertexBuffer<T, InlineCapacity>::VertexBuffer(const VertexBuffer& rhs) noexcept
+    : inlineSize_(rhs.inlineSize_)
+{
+    if (rhs.isInline())
+    {
+        std::construct_at(&inline_, rhs.inline_);
+    }
+    else
+    {
+        std::construct_at(&heap_, rhs.heap_);
+    }
+}
+
+template <Scalar T, size_t InlineCapacity>
+VertexBuffer<T, InlineCapacity>& VertexBuffer<T, InlineCapacity>::operator=(const VertexBuffer& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        destroy();
+        std::construct_at(this, rhs);
+    }
+    return *this;
+}
+
+template <Scalar T, size_t InlineCapacity>
+VertexBuffer<T, InlineCapacity>::VertexBuffer(VertexBuffer&& rhs) noexcept
+    : inlineSize_(rhs.inlineSize_)
+{
+    if (rhs.isInline())
+    {
+        std::construct_at(&inline_, rhs.inline_);
+    }
+    else
+    {
+        std::construct_at(&heap_, std::move(rhs.heap_));
+        rhs.destroy();
+        std::construct_at(&rhs.inline_);
+    }
+    rhs.inlineSize_ = 0;
+}
+
+template <Scalar T, size_t InlineCapacity>
+VertexBuffer<T, InlineCapacity>& VertexBuffer<T, InlineCapacity>::operator=(VertexBuffer&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        destroy();
+        std::construct_at(this, std::move(rhs));
+    }
+    return *this;
+}
+
+template <Scalar T, size_t InlineCapacity>
+VertexBuffer<T, InlineCapacity>::~VertexBuffer() noexcept
+{
+    destroy();
+}
+
+template <Scalar T, size_t InlineCapacity>
+constexpr size_t VertexBuffer<T, InlineCapacity>::inlineCapacity() noexcept
+{
+    return InlineCapacity;
+}
+
+template <Scalar T, size_t InlineCapacity>
+size_t VertexBuffer<T, InlineCapacity>::size() const noexcept
+{
+    return isInline() ? inlineSize_ : heap_->size();
+}
+
+template <Scalar T, size_t InlineCapacity>
+bool VertexBuffer<T, InlineCapacity>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <Scalar T, size_t InlineCapacity>
+bool VertexBuffer<T, InlineCapacity>::isInline() const noexcept
+{
+    return inlineSize_ != heapTag_;
+}
+
+template <Scalar T, size_t InlineCapacity>
+bool VertexBuffer<T, InlineCapacity>::isShared() const noexcept
+{
+    return !isInline() && heap_.use_count() > 1;
+}
+
+template <Scalar T, size_t InlineCapacity>
+const Point<T>& VertexBuffer<T, InlineCapacity>::operator[](size_t index) const
+{
+    return isInline() ? inline_[index] : (*heap_)[index];
+}
+
+template <Scalar T, size_t InlineCapacity>
+std::span<const Point<T>> VertexBuffer<T, InlineCapacity>::view() const noexcept
+{
+    if (isInline())
+    {
+        return std::span<const Point<T>>(inline_.data(), inlineSize_);
+    }
+    return std::span<const Point<T>>(heap_->data(), heap_->size());
+}
+
+template <Scalar T, size_t InlineCapacity>
+Point<T>& VertexBuffer<T, InlineCapacity>::mutableAt(size_t index)
+{
+    return isInline() ? inline_[index] : detach()[index];
+}
+
+template <Scalar T, size_t InlineCapacity>
+std::span<Point<T>> VertexBuffer<T, InlineCapacity>::mutableView()
+{
+    if (isInline())
+    {
+        return std::span<Point<T>>(inline_.data(), inlineSize_);
+    }
+    auto& vertices = detach();
+    return std::span<Point<T>>(vertices.data(), vertices.size());
+}
+
+template <Scalar T, size_t InlineCapacity>
+std::vector<Point<T>>& VertexBuffer<T, InlineCapacity>::detach()
+{
+    if (heap_.use_count() != 1)
+    {
+        heap_ = std::make_shared<std::vector<Point<T>>>(*heap_);
+    }
+    else
+    {
+        // use_count() is a relaxed load; the fence pairs it with the releasing decrement of the last other owner.
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    // Every heap buffer is created as a non-const vector, so dropping const is sound once we own it alone.
+    return const_cast<std::vector<Point<T>>&>(*heap_);
+}
+
+template <Scalar T, size_t InlineCapacity>
+void VertexBuffer<T, InlineCapacity>::destroy() noexcept
+{
+    if (isInline())
+    {
+        std::destroy_at(&inline_);
+    }
+    else
+    {
+        std::destroy_at(&heap_);
+    }
+}
+
+#endif //VERTEXBUFFER_H
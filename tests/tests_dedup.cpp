@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+#include "FigureDedup.h"
+#include "Rectangle.h"
+#include "Square.h"
+#include "Trapezoid.h"
+
+// ==================== Canonical Form Tests ====================
+
+class CanonicalFormTest : public ::testing::Test {
+protected:
+    static std::vector<Point<double>> rotated(const std::vector<Point<double>>& points, size_t shift, bool reversed) {
+        std::vector<Point<double>> result;
+        for (size_t i = 0; i < points.size(); ++i) {
+            size_t index = reversed ? (shift + points.size() - i) % points.size() : (shift + i) % points.size();
+            result.push_back(points[index]);
+        }
+        return result;
+    }
+
+    static bool samePoints(const std::vector<Point<double>>& lhs, const std::vector<Point<double>>& rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.size(); ++i) {
+            if (lhs[i].x != rhs[i].x || lhs[i].y != rhs[i].y) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+TEST_F(CanonicalFormTest, IgnoresStartingVertexAndWinding) {
+    std::vector<Point<double>> points = {{3, 1}, {5, 2}, {4, 6}, {1, 4}, {0, 2}};
+    auto expected = canonicalVertices(std::span<const Point<double>>(points));
+    EXPECT_EQ(expected[0].x, 0);
+    EXPECT_EQ(expected[0].y, 2);
+
+    for (size_t shift = 0; shift < points.size(); ++shift) {
+        for (bool reversed : {false, true}) {
+            auto variant = rotated(points, shift, reversed);
+            std::span<const Point<double>> view(variant);
+            EXPECT_TRUE(samePoints(canonicalVertices(view), expected));
+            EXPECT_EQ(canonicalHash(view), canonicalHash(std::span<const Point<double>>(points)));
+        }
+    }
+}
+
+TEST_F(CanonicalFormTest, RepeatedSmallestVertex) {
+    std::vector<Point<double>> points = {{0, 0}, {2, 1}, {0, 0}, {1, 3}, {3, 3}};
+    auto expected = canonicalVertices(std::span<const Point<double>>(points));
+    for (size_t shift = 0; shift < points.size(); ++shift) {
+        for (bool reversed : {false, true}) {
+            auto variant = rotated(points, shift, reversed);
+            EXPECT_TRUE(samePoints(canonicalVertices(std::span<const Point<double>>(variant)), expected));
+        }
+    }
+}
+
+TEST_F(CanonicalFormTest, NegativeZeroMatchesZero) {
+    std::vector<Point<double>> positive = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    std::vector<Point<double>> negative = {{-0.0, -0.0}, {1, -0.0}, {1, 1}, {-0.0, 1}};
+    EXPECT_EQ(canonicalHash(std::span<const Point<double>>(positive)), canonicalHash(std::span<const Point<double>>(negative)));
+    auto canonical = canonicalVertices(std::span<const Point<double>>(negative));
+    EXPECT_FALSE(std::signbit(canonical[0].x));
+    EXPECT_FALSE(std::signbit(canonical[0].y));
+}
+
+TEST_F(CanonicalFormTest, DifferentFiguresHashDifferently) {
+    std::vector<Point<double>> square = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    std::vector<Point<double>> shifted = {{0, 0}, {1, 0}, {1, 1}, {0, 2}};
+    std::vector<Point<double>> triangle = {{0, 0}, {1, 0}, {1, 1}};
+    uint64_t hash = canonicalHash(std::span<const Point<double>>(square));
+    EXPECT_NE(hash, canonicalHash(std::span<const Point<double>>(shifted)));
+    EXPECT_NE(hash, canonicalHash(std::span<const Point<double>>(triangle)));
+}
+
+TEST_F(CanonicalFormTest, IntegerCoordinates) {
+    std::vector<Point<int>> points = {{2, -1}, {4, 3}, {-1, 2}};
+    std::vector<Point<int>> reversed = {{-1, 2}, {4, 3}, {2, -1}};
+    auto canonical = canonicalVertices(std::span<const Point<int>>(points));
+    EXPECT_EQ(canonical[0].x, -1);
+    EXPECT_EQ(canonicalHash(std::span<const Point<int>>(points)), canonicalHash(std::span<const Point<int>>(reversed)));
+}
+
+// ==================== Dedup Table Tests ====================
+
+TEST(DedupTableTest, InternsEquivalentFiguresOnce) {
+    DedupTable<Rectangle<double>> table;
+    Rectangle<double> first({{0, 0}, {4, 0}, {4, 2}, {0, 2}});
+    Rectangle<double> rotated({{4, 2}, {0, 2}, {0, 0}, {4, 0}});
+    Rectangle<double> clockwise({{0, 0}, {0, 2}, {4, 2}, {4, 0}});
+    Rectangle<double> other({{0, 0}, {5, 0}, {5, 2}, {0, 2}});
+
+    const auto& entry = table.intern(first);
+    EXPECT_EQ(&table.intern(rotated), &entry);
+    EXPECT_EQ(&table.intern(clockwise), &entry);
+    EXPECT_NE(&table.intern(other), &entry);
+
+    EXPECT_DOUBLE_EQ(entry.area, 8.0);
+    EXPECT_DOUBLE_EQ(entry.center.x, 2.0);
+    EXPECT_DOUBLE_EQ(entry.center.y, 1.0);
+    EXPECT_EQ(entry.figure.vertices()[1].x, 4);
+}
+
+TEST(DedupTableTest, StatsReportRatioAndBytesSaved) {
+    DedupTable<Square<double>> table(4);
+    EXPECT_DOUBLE_EQ(table.stats().ratio(), 1.0);
+
+    Square<double> square({{0, 0}, {1, 0}, {1, 1}, {0, 1}});
+    for (int i = 0; i < 10; ++i) {
+        table.intern(square);
+    }
+    table.intern(Square<double>({{0, 0}, {2, 0}, {2, 2}, {0, 2}}));
+
+    DedupStats stats = table.stats();
+    EXPECT_EQ(stats.lookups, 11u);
+    EXPECT_EQ(stats.unique, 2u);
+    EXPECT_DOUBLE_EQ(stats.ratio(), 5.5);
+    EXPECT_EQ(stats.bytesSaved, 9 * sizeof(Square<double>));
+    EXPECT_GE(stats.tableBytes, 2 * sizeof(InternedFigure<Square<double>>));
+    EXPECT_EQ(stats.netBytesSaved(), static_cast<int64_t>(stats.bytesSaved) - static_cast<int64_t>(stats.tableBytes));
+}
+
+TEST(DedupTableTest, BytesSavedCountsHeapVertices) {
+    DedupTable<Polygon<double>> table;
+    std::vector<Point<double>> points;
+    for (int i = 0; i < 12; ++i) {
+        points.emplace_back(std::cos(i * 0.5), std::sin(i * 0.5));
+    }
+    table.intern(Polygon<double>(points));
+    table.intern(Polygon<double>(points));
+    EXPECT_EQ(table.stats().bytesSaved, sizeof(Polygon<double>) + 12 * sizeof(Point<double>));
+    EXPECT_GE(table.stats().tableBytes, sizeof(InternedFigure<Polygon<double>>) + 12 * sizeof(Point<double>));
+}
+
+TEST(DedupTableTest, InternFromVertices) {
+    DedupTable<Trapezoid<double>> table;
+    std::vector<Point<double>> points = {{0, 0}, {4, 0}, {3, 2}, {1, 2}};
+    const auto& entry = table.intern(std::span<const Point<double>>(points));
+    EXPECT_DOUBLE_EQ(entry.area, 6.0);
+    EXPECT_EQ(&table.intern(Trapezoid<double>({{1, 2}, {3, 2}, {4, 0}, {0, 0}})), &entry);
+
+    std::vector<Point<double>> triangle = {{0, 0}, {1, 0}, {0, 1}};
+    EXPECT_THROW(table.intern(std::span<const Point<double>>(triangle)), std::invalid_argument);
+    EXPECT_THROW(DedupTable<Trapezoid<double>>(0), std::invalid_argument);
+}
+
+TEST(DedupTableTest, ConcurrentInternAll) {
+    std::mt19937 generator(3);
+    std::uniform_int_distribution<int> pick(0, 99);
+    std::uniform_int_distribution<size_t> shift(0, 3);
+    std::vector<std::unique_ptr<Rectangle<double>>> rects;
+    std::vector<int> kinds;
+    for (size_t i = 0; i < 50'000; ++i) {
+        int kind = pick(generator);
+        double x = kind;
+        std::vector<Point<double>> ring = {{x, 0}, {x + 1, 0}, {x + 1, 3}, {x, 3}};
+        size_t s = shift(generator);
+        bool reversed = i % 2 == 0;
+        auto point = [&](size_t k) { return ring[reversed ? (s + 4 - k) % 4 : (s + k) % 4]; };
+        rects.push_back(std::make_unique<Rectangle<double>>(std::initializer_list<Point<double>>{point(0), point(1), point(2), point(3)}));
+        kinds.push_back(kind);
+    }
+
+    DedupTable<Rectangle<double>> table;
+    auto entries = table.internAll(rects);
+    ASSERT_EQ(entries.size(), rects.size());
+
+    std::vector<const InternedFigure<Rectangle<double>>*> byKind(100, nullptr);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        auto& expected = byKind[static_cast<size_t>(kinds[i])];
+        if (expected == nullptr) {
+            expected = entries[i];
+        }
+        EXPECT_EQ(entries[i], expected);
+        EXPECT_DOUBLE_EQ(entries[i]->area, 3.0);
+    }
+    EXPECT_EQ(table.stats().unique, 100u);
+    EXPECT_EQ(table.stats().lookups, rects.size());
+}
+
+TEST(DedupTableTest, InternAllFromVertexRings) {
+    std::vector<std::vector<Point<double>>> rings;
+    for (int copy = 0; copy < 3; ++copy) {
+        rings.push_back({{0, 0}, {2, 0}, {2, 1}, {0, 1}});
+        rings.push_back({{2, 1}, {2, 0}, {0, 0}, {0, 1}});
+        rings.push_back({{0, 0}, {3, 0}, {4, 2}, {2, 4}, {-1, 2}});
+        rings.push_back({{2, 4}, {4, 2}, {3, 0}, {0, 0}, {-1, 2}});
+    }
+    std::vector<std::span<const Point<double>>> views(rings.begin(), rings.end());
+
+    DedupTable<Polygon<double>> table;
+    auto entries = table.internAll(views);
+    ASSERT_EQ(entries.size(), views.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        EXPECT_EQ(entries[i], entries[i % 4 < 2 ? 0 : 2]);
+    }
+    EXPECT_DOUBLE_EQ(entries[0]->area, 2.0);
+    EXPECT_EQ(&table.intern(std::span<const Point<double>>(rings[3])), entries[2]);
+    EXPECT_EQ(table.stats().unique, 2u);
+    EXPECT_EQ(table.stats().lookups, views.size() + 1);
+}
@@ -1,9 +1,14 @@
 #include <gtest/gtest.h>
 #include <sstream>
 #include <memory>
+#include <thread>
+#include <atomic>
+#include <cmath>
+#include <random>
 #include "Point.h"
 #include "Figure.h"
 #include "Polygon.h"
+#include "VertexBuffer.h"
 #include "Rectangle.h"
 #include "Square.h"
 #include "Trapezoid.h"
@@ -541,4 +546,276 @@ TEST_F(ProtectedConstructorTest, TrapezoidOutputOperator) {
     std::ostringstream oss;
     EXPECT_NO_THROW(oss << trap);
     EXPECT_GT(oss.str().length(), 0);
-}
\ No newline at end of file
+}
+
+// ==================== Copy-On-Write Tests ====================
+
+class CopyOnWriteTest : public ::testing::Test {
+protected:
+    using PolygonInt = Polygon<int>;
+    using RectangleInt = Rectangle<int>;
+
+    static PolygonInt makeLargePolygon() {
+        std::vector<Point<int>> points;
+        for (int i = 0; i < 12; ++i) {
+            points.emplace_back(i, i * i);
+        }
+        points.emplace_back(0, 200);
+        return PolygonInt(points);
+    }
+};
+
+TEST_F(CopyOnWriteTest, CopySharesVertexBuffer) {
+    PolygonInt polygon = makeLargePolygon();
+    PolygonInt copy(polygon);
+    EXPECT_EQ(polygon.vertices().data(), copy.vertices().data());
+    EXPECT_DOUBLE_EQ(static_cast<double>(copy), static_cast<double>(polygon));
+}
+
+TEST_F(CopyOnWriteTest, CopyAssignmentSharesVertexBuffer) {
+    PolygonInt polygon = makeLargePolygon();
+    PolygonInt copy(3);
+    copy = polygon;
+    EXPECT_EQ(polygon.vertices().data(), copy.vertices().data());
+}
+
+TEST_F(CopyOnWriteTest, MutationDetachesOnlyWriter) {
+    PolygonInt polygon = makeLargePolygon();
+    PolygonInt copy(polygon);
+    double area = static_cast<double>(polygon);
+    std::istringstream iss("0 0 1 0 1 1 0 1 0 1 0 1 0 1 0 1 0 1 0 1 0 1 0 1 0 1");
+    iss >> copy;
+
+    EXPECT_NE(polygon.vertices().data(), copy.vertices().data());
+    EXPECT_DOUBLE_EQ(static_cast<double>(polygon), area);
+    EXPECT_DOUBLE_EQ(static_cast<double>(copy), 1.0);
+}
+
+TEST_F(CopyOnWriteTest, UnsharedMutationKeepsBuffer) {
+    PolygonInt polygon = makeLargePolygon();
+    const Point<int>* before = polygon.vertices().data();
+    std::istringstream iss("0 0 1 0 1 1 0 1 0 1 0 1 0 1 0 1 0 1 0 1 0 1 0 1 0 1");
+    iss >> polygon;
+    EXPECT_EQ(polygon.vertices().data(), before);
+}
+
+TEST_F(CopyOnWriteTest, SmallFiguresCopyInline) {
+    RectangleInt rect({{0, 0}, {5, 0}, {5, 5}, {0, 5}});
+    RectangleInt copy(rect);
+    std::istringstream iss("0 0 2 0 2 2 0 2");
+    iss >> copy;
+
+    EXPECT_NE(rect.vertices().data(), copy.vertices().data());
+    EXPECT_DOUBLE_EQ(static_cast<double>(rect), 25.0);
+    EXPECT_DOUBLE_EQ(static_cast<double>(copy), 4.0);
+}
+
+TEST_F(CopyOnWriteTest, MovedFromIsEmpty) {
+    RectangleInt rect({{0, 0}, {5, 0}, {5, 5}, {0, 5}});
+    RectangleInt moved(std::move(rect));
+    std::ostringstream oss;
+    oss << rect;
+    EXPECT_EQ(oss.str(), "empty");
+    EXPECT_DOUBLE_EQ(static_cast<double>(moved), 25.0);
+}
+
+TEST_F(CopyOnWriteTest, SnapshotOfCollectionSharesBuffers) {
+    std::vector<PolygonInt> figures(100, makeLargePolygon());
+    std::vector<PolygonInt> snapshot = figures;
+    for (size_t i = 0; i < figures.size(); ++i) {
+        EXPECT_EQ(figures[i].vertices().data(), snapshot[i].vertices().data());
+    }
+}
+
+TEST_F(CopyOnWriteTest, ConcurrentReadersOfSharedBuffer) {
+    const PolygonInt polygon = makeLargePolygon();
+    const double area = static_cast<double>(polygon);
+    std::vector<std::thread> readers;
+    std::atomic<int> mismatches = 0;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&polygon, &mismatches, area] {
+            for (int i = 0; i < 1000; ++i) {
+                PolygonInt copy(polygon);
+                if (static_cast<double>(copy) != area) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(mismatches, 0);
+}
+
+// ==================== Small Buffer Tests ====================
+
+class SmallBufferTest : public ::testing::Test {};
+
+TEST_F(SmallBufferTest, SmallPolygonStaysInline) {
+    VertexBuffer<int, 8> buffer({{0, 0}, {1, 0}, {1, 1}});
+    EXPECT_TRUE(buffer.isInline());
+    EXPECT_EQ(buffer.size(), 3);
+}
+
+TEST_F(SmallBufferTest, LargePolygonSpillsToHeap) {
+    VertexBuffer<int, 4> buffer({{0, 0}, {1, 0}, {2, 1}, {1, 2}, {0, 1}});
+    EXPECT_FALSE(buffer.isInline());
+    EXPECT_EQ(buffer.size(), 5);
+    EXPECT_EQ(buffer[4].y, 1);
+}
+
+TEST_F(SmallBufferTest, HeapPointerSharesInlineStorage) {
+    EXPECT_EQ((sizeof(VertexBuffer<double, 8>)), 8 * sizeof(Point<double>) + sizeof(size_t));
+
+    VertexBuffer<int, 2> spilled({{0, 0}, {1, 0}, {1, 1}});
+    VertexBuffer<int, 2> small({{5, 5}});
+    small = spilled;
+    EXPECT_TRUE(small.isShared());
+    spilled = VertexBuffer<int, 2>({{7, 7}});
+    EXPECT_TRUE(spilled.isInline());
+    EXPECT_EQ(spilled[0].x, 7);
+
+    VertexBuffer<int, 2> moved(std::move(small));
+    EXPECT_TRUE(small.isInline());
+    EXPECT_TRUE(small.empty());
+    EXPECT_EQ(moved.size(), 3);
+    EXPECT_FALSE(moved.isShared());
+}
+
+TEST_F(SmallBufferTest, InlineCapacityIsConfigurable) {
+    Polygon<double, 3> triangle({{0.0, 0.0}, {4.0, 0.0}, {0.0, 3.0}});
+    Polygon<double, 3> quad({{0.0, 0.0}, {4.0, 0.0}, {4.0, 3.0}, {0.0, 3.0}});
+    EXPECT_DOUBLE_EQ(static_cast<double>(triangle), 6.0);
+    EXPECT_DOUBLE_EQ(static_cast<double>(quad), 12.0);
+    EXPECT_EQ((VertexBuffer<double, 3>::inlineCapacity()), 3);
+}
+
+TEST_F(SmallBufferTest, MoveIsNoexcept) {
+    EXPECT_TRUE(std::is_nothrow_move_constructible_v<Polygon<int>>);
+    EXPECT_TRUE(std::is_nothrow_move_assignable_v<Polygon<int>>);
+    EXPECT_TRUE(std::is_nothrow_move_constructible_v<Rectangle<int>>);
+    EXPECT_TRUE(std::is_nothrow_move_constructible_v<Trapezoid<double>>);
+}
+
+TEST_F(SmallBufferTest, MoveTransfersInlineVertices) {
+    Polygon<int> polygon({{0, 0}, {4, 0}, {4, 4}, {0, 4}});
+    Polygon<int> moved(3);
+    moved = std::move(polygon);
+    EXPECT_DOUBLE_EQ(static_cast<double>(moved), 16.0);
+    EXPECT_TRUE(polygon.vertices().empty());
+}
+
+// ==================== Incremental Metrics Tests ====================
+
+class IncrementalMetricsTest : public ::testing::Test {
+protected:
+    template <Scalar T, size_t N>
+    static double fullArea(const Polygon<T, N>& polygon) {
+        auto vertices = polygon.vertices();
+        double area = 0;
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            size_t j = (i + 1) % vertices.size();
+            area += static_cast<double>(vertices[i].x) * vertices[j].y;
+            area -= static_cast<double>(vertices[j].x) * vertices[i].y;
+        }
+        return std::abs(area) / 2;
+    }
+
+    template <Scalar T, size_t N>
+    static Point<double> fullCenter(const Polygon<T, N>& polygon) {
+        auto vertices = polygon.vertices();
+        double x = 0;
+        double y = 0;
+        for (const auto& vertex : vertices) {
+            x += vertex.x;
+            y += vertex.y;
+        }
+        return Point<double>(x / static_cast<double>(vertices.size()), y / static_cast<double>(vertices.size()));
+    }
+};
+
+TEST_F(IncrementalMetricsTest, SetVertexUpdatesArea) {
+    Rectangle<int> rect({{0, 0}, {4, 0}, {4, 4}, {0, 4}});
+    rect.setVertex(2, {8, 4});
+    EXPECT_DOUBLE_EQ(static_cast<double>(rect), 24.0);
+    EXPECT_EQ(rect.calcGeometricCenter().x, 3);
+}
+
+TEST_F(IncrementalMetricsTest, SetVertexOutOfRangeThrows) {
+    Trapezoid<int> trap({{0, 0}, {4, 0}, {3, 2}, {1, 2}});
+    EXPECT_THROW(trap.setVertex(4, {0, 0}), std::out_of_range);
+}
+
+TEST_F(IncrementalMetricsTest, SetVerticesMatchesConstructor) {
+    std::vector<Point<double>> points = {{0.1, 0.3}, {4.7, 0.2}, {3.9, 2.6}, {1.3, 2.2}};
+    Trapezoid<double> constructed({points[0], points[1], points[2], points[3]});
+    Trapezoid<double> assigned;
+    assigned.setVertices(points);
+    EXPECT_EQ(static_cast<double>(assigned), static_cast<double>(constructed));
+    EXPECT_EQ(assigned.calcGeometricCenter().x, constructed.calcGeometricCenter().x);
+    EXPECT_THROW(assigned.setVertices(std::span<const Point<double>>(points).first(3)), std::invalid_argument);
+}
+
+TEST_F(IncrementalMetricsTest, SetVertexDetachesSharedBuffer) {
+    std::vector<Point<int>> points;
+    for (int i = 0; i < 16; ++i) {
+        points.emplace_back(i, i % 3);
+    }
+    Polygon<int> polygon(points);
+    Polygon<int> snapshot(polygon);
+    double area = static_cast<double>(snapshot);
+    polygon.setVertex(5, {5, 100});
+    EXPECT_DOUBLE_EQ(static_cast<double>(snapshot), area);
+    EXPECT_DOUBLE_EQ(static_cast<double>(polygon), fullArea(polygon));
+}
+
+TEST_F(IncrementalMetricsTest, RandomEditsMatchFullRecomputeInt) {
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> coordinate(-1000, 1000);
+    std::vector<Point<int>> points;
+    for (int i = 0; i < 64; ++i) {
+        points.emplace_back(coordinate(generator), coordinate(generator));
+    }
+    Polygon<int> polygon(points);
+    std::uniform_int_distribution<size_t> index(0, points.size() - 1);
+    for (int edit = 0; edit < 10000; ++edit) {
+        polygon.setVertex(index(generator), {coordinate(generator), coordinate(generator)});
+        if (edit % 97 == 0) {
+            ASSERT_DOUBLE_EQ(static_cast<double>(polygon), fullArea(polygon));
+        }
+    }
+    EXPECT_DOUBLE_EQ(static_cast<double>(polygon), fullArea(polygon));
+    int sumX = 0;
+    for (const auto& vertex : polygon.vertices()) {
+        sumX += vertex.x;
+    }
+    EXPECT_EQ(polygon.calcGeometricCenter().x, sumX / 64);
+}
+
+TEST_F(IncrementalMetricsTest, RandomEditsMatchFullRecomputeDouble) {
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<double> coordinate(-1e4, 1e4);
+    std::vector<Point<double>> points;
+    for (int i = 0; i < 1000; ++i) {
+        points.emplace_back(coordinate(generator), coordinate(generator));
+    }
+    Polygon<double> polygon(points);
+    std::uniform_int_distribution<size_t> index(0, points.size() - 1);
+    for (int edit = 0; edit < 20000; ++edit) {
+        polygon.setVertex(index(generator), {coordinate(generator), coordinate(generator)});
+    }
+    double area = fullArea(polygon);
+    auto center = fullCenter(polygon);
+    EXPECT_NEAR(static_cast<double>(polygon), area, 1e-6 * std::max(area, 1e4));
+    EXPECT_NEAR(polygon.calcGeometricCenter().x, center.x, 1e-6);
+    EXPECT_NEAR(polygon.calcGeometricCenter().y, center.y, 1e-6);
+}
+
+TEST_F(IncrementalMetricsTest, InputOperatorRefreshesMetrics) {
+    Square<int> square({{0, 0}, {4, 0}, {4, 4}, {0, 4}});
+    std::istringstream iss("0 0 2 0 2 2 0 2");
+    iss >> square;
+    EXPECT_DOUBLE_EQ(static_cast<double>(square), 4.0);
+    EXPECT_EQ(square.calcGeometricCenter().x, 1);
+}
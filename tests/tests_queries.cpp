@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+#include "FigureQueries.h"
+#include "Rectangle.h"
+#include "Square.h"
+#include "Trapezoid.h"
+
+// ==================== Figure Query Tests ====================
+
+class FigureQueryTest : public ::testing::Test {
+protected:
+    static std::vector<std::shared_ptr<Figure<double>>> makeFigures(size_t amount) {
+        std::mt19937 generator(3);
+        std::uniform_real_distribution<double> size(0.1, 100.0);
+        std::uniform_real_distribution<double> offset(-1000.0, 1000.0);
+        std::vector<std::shared_ptr<Figure<double>>> figures;
+        for (size_t i = 0; i < amount; ++i) {
+            double x = offset(generator);
+            double y = offset(generator);
+            double w = size(generator);
+            double h = size(generator);
+            if (i % 3 == 0) {
+                figures.push_back(std::make_shared<Square<double>>(
+                    std::initializer_list<Point<double>>{{x, y}, {x + w, y}, {x + w, y + w}, {x, y + w}}));
+            } else if (i % 3 == 1) {
+                figures.push_back(std::make_shared<Rectangle<double>>(
+                    std::initializer_list<Point<double>>{{x, y}, {x + w, y}, {x + w, y + h}, {x, y + h}}));
+            } else {
+                figures.push_back(std::make_shared<Trapezoid<double>>(
+                    std::initializer_list<Point<double>>{{x, y}, {x + 2 * w, y}, {x + w, y + h}, {x + w / 2, y + h}}));
+            }
+        }
+        return figures;
+    }
+};
+
+TEST_F(FigureQueryTest, ComputeAreaKeys) {
+    auto figures = makeFigures(1000);
+    auto keys = computeKeys(figures);
+    ASSERT_EQ(keys.size(), figures.size());
+    for (size_t i = 0; i < figures.size(); ++i) {
+        EXPECT_DOUBLE_EQ(keys[i], static_cast<double>(*figures[i]));
+    }
+}
+
+TEST_F(FigureQueryTest, ComputeCenterKeysOverValues) {
+    std::vector<Rectangle<int>> rects = {
+        Rectangle<int>({{0, 0}, {2, 0}, {2, 2}, {0, 2}}),
+        Rectangle<int>({{10, 4}, {12, 4}, {12, 8}, {10, 8}}),
+    };
+    auto xs = computeKeys(rects, CenterXKey{});
+    auto ys = computeKeys(rects, CenterYKey{});
+    EXPECT_DOUBLE_EQ(xs[1], 11.0);
+    EXPECT_DOUBLE_EQ(ys[1], 6.0);
+}
+
+TEST_F(FigureQueryTest, RadixSortMatchesStdSort) {
+    std::mt19937 generator(5);
+    std::uniform_real_distribution<double> value(-1e6, 1e6);
+    std::vector<double> keys(300000);
+    for (auto& key : keys) {
+        key = value(generator);
+    }
+    keys[10] = 0.0;
+    keys[11] = -0.0;
+    keys[12] = keys[13];
+
+    auto order = sortIndicesByKey(keys);
+    ASSERT_EQ(order.size(), keys.size());
+    EXPECT_TRUE(std::is_sorted(order.begin(), order.end(),
+                               [&](size_t a, size_t b) { return keys[a] < keys[b]; }));
+    auto sorted = order;
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        ASSERT_EQ(sorted[i], i);
+    }
+}
+
+TEST_F(FigureQueryTest, RadixSortIsStableAndDescending) {
+    std::vector<double> keys = {3.0, 1.0, 3.0, 2.0, 1.0};
+    EXPECT_EQ(sortIndicesByKey(keys), (std::vector<size_t>{1, 4, 3, 0, 2}));
+    EXPECT_EQ(sortIndicesByKey(keys, true), (std::vector<size_t>{0, 2, 3, 1, 4}));
+    EXPECT_TRUE(sortIndicesByKey(std::vector<double>{}).empty());
+}
+
+TEST_F(FigureQueryTest, TopKReturnsLargestFirst) {
+    auto figures = makeFigures(5000);
+    auto keys = computeKeys(figures);
+    auto top = topK(keys, 10);
+    ASSERT_EQ(top.size(), 10);
+
+    auto sorted = keys;
+    std::sort(sorted.begin(), sorted.end(), std::greater<>());
+    for (size_t i = 0; i < top.size(); ++i) {
+        EXPECT_DOUBLE_EQ(keys[top[i]], sorted[i]);
+    }
+}
+
+TEST_F(FigureQueryTest, TopKLargerThanInput) {
+    std::vector<double> keys = {1.0, 5.0, 3.0};
+    EXPECT_EQ(topK(keys, 10), (std::vector<size_t>{1, 2, 0}));
+    EXPECT_TRUE(topK(keys, 0).empty());
+}
+
+TEST_F(FigureQueryTest, QuantileSketchWithinRelativeError) {
+    std::mt19937 generator(9);
+    std::lognormal_distribution<double> value(3.0, 1.5);
+    std::vector<double> keys(200000);
+    for (auto& key : keys) {
+        key = value(generator);
+    }
+    auto sketch = buildQuantileSketch(keys, 0.01);
+    EXPECT_EQ(sketch.count(), keys.size());
+
+    auto sorted = keys;
+    std::sort(sorted.begin(), sorted.end());
+    for (double q : {0.0, 0.1, 0.5, 0.9, 0.99, 1.0}) {
+        double exact = sorted[static_cast<size_t>(q * static_cast<double>(sorted.size() - 1))];
+        EXPECT_NEAR(sketch.quantile(q), exact, 0.0101 * exact);
+    }
+}
+
+TEST_F(FigureQueryTest, QuantileSketchHandlesSignsAndZero) {
+    QuantileSketch sketch;
+    for (double key : {-4.0, -2.0, 0.0, 2.0, 4.0}) {
+        sketch.add(key);
+    }
+    EXPECT_NEAR(sketch.quantile(0.0), -4.0, 0.05);
+    EXPECT_DOUBLE_EQ(sketch.quantile(0.5), 0.0);
+    EXPECT_NEAR(sketch.quantile(1.0), 4.0, 0.05);
+    EXPECT_THROW(QuantileSketch().quantile(0.5), std::invalid_argument);
+}
+
+TEST_F(FigureQueryTest, HistogramCountsEveryKey) {
+    auto figures = makeFigures(10000);
+    auto keys = computeKeys(figures);
+    auto histogram = buildHistogram(keys, 20);
+    ASSERT_EQ(histogram.counts.size(), 20);
+
+    uint64_t total = 0;
+    for (auto count : histogram.counts) {
+        total += count;
+    }
+    EXPECT_EQ(total, keys.size());
+    EXPECT_DOUBLE_EQ(histogram.min, *std::min_element(keys.begin(), keys.end()));
+}
+
+TEST_F(FigureQueryTest, HistogramFixedBounds) {
+    std::vector<double> keys = {0.5, 1.5, 1.6, 2.5, -10.0, 10.0};
+    auto histogram = buildHistogram(keys, 3, 0.0, 3.0);
+    EXPECT_EQ(histogram.counts, (std::vector<uint64_t>{2, 2, 2}));
+    EXPECT_THROW(buildHistogram(keys, 0, 0.0, 1.0), std::invalid_argument);
+}
+
+TEST_F(FigureQueryTest, HistogramSkipsNaN) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> keys = {nan, 1.0, 2.0, nan, 3.0};
+    auto histogram = buildHistogram(keys, 2);
+    EXPECT_DOUBLE_EQ(histogram.min, 1.0);
+    EXPECT_DOUBLE_EQ(histogram.max, 3.0);
+    EXPECT_EQ(histogram.counts, (std::vector<uint64_t>{1, 2}));
+
+    std::vector<double> onlyNaN = {nan, nan};
+    EXPECT_EQ(buildHistogram(onlyNaN, 2).counts, (std::vector<uint64_t>{0, 0}));
+}
+
+TEST_F(FigureQueryTest, HistogramSkipsInfinity) {
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> keys = {inf, 1.0, 2.0, -inf, 3.0};
+    auto histogram = buildHistogram(keys, 2);
+    EXPECT_DOUBLE_EQ(histogram.min, 1.0);
+    EXPECT_DOUBLE_EQ(histogram.max, 3.0);
+    EXPECT_EQ(histogram.counts, (std::vector<uint64_t>{1, 2}));
+    EXPECT_EQ(buildHistogram(keys, 3, 0.0, 3.0).counts, (std::vector<uint64_t>{0, 1, 2}));
+    EXPECT_THROW(buildHistogram(keys, 2, 0.0, inf), std::invalid_argument);
+}
+
+TEST_F(FigureQueryTest, TopKSkipsNonFinite) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> keys = {nan, 3.0, 1.0, nan, 2.0};
+    EXPECT_EQ(topK(keys, 2), (std::vector<size_t>{1, 4}));
+
+    std::vector<double> withInfinity = {inf, 1.0, nan, -inf};
+    EXPECT_EQ(topK(withInfinity, 3), (std::vector<size_t>{1}));
+}
+
+TEST_F(FigureQueryTest, QuantileSketchSkipsNonFinite) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    QuantileSketch sketch;
+    for (double key : {nan, nan, nan, 5.0, inf, -inf}) {
+        sketch.add(key);
+    }
+    EXPECT_EQ(sketch.count(), 1u);
+    EXPECT_NEAR(sketch.quantile(0.5), 5.0, 0.06);
+
+    std::vector<double> keys = {inf, 1.0};
+    EXPECT_NEAR(buildQuantileSketch(keys).quantile(1.0), 1.0, 0.011);
+}
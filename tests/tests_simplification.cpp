@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <vector>
+#include "Polygon.h"
+#include "PolygonSimplification.h"
+#include "Rectangle.h"
+
+// ==================== Simplification Tests ====================
+
+class SimplificationTest : public ::testing::Test {
+protected:
+    using PolygonDouble = Polygon<double>;
+
+    static PolygonDouble makeNoisyCircle(size_t amountOfVertices, double radius, double noise) {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<double> jitter(-noise, noise);
+        std::vector<Point<double>> points;
+        for (size_t i = 0; i < amountOfVertices; ++i) {
+            double angle = 2 * std::numbers::pi * static_cast<double>(i) / static_cast<double>(amountOfVertices);
+            double r = radius + jitter(generator);
+            points.emplace_back(r * std::cos(angle), r * std::sin(angle));
+        }
+        return PolygonDouble(points);
+    }
+
+    static PolygonDouble makeDenseSquare(size_t pointsPerSide) {
+        std::vector<Point<double>> points;
+        for (size_t i = 0; i < pointsPerSide; ++i) {
+            points.emplace_back(static_cast<double>(i), 0.0);
+        }
+        for (size_t i = 0; i < pointsPerSide; ++i) {
+            points.emplace_back(static_cast<double>(pointsPerSide), static_cast<double>(i));
+        }
+        for (size_t i = 0; i < pointsPerSide; ++i) {
+            points.emplace_back(static_cast<double>(pointsPerSide - i), static_cast<double>(pointsPerSide));
+        }
+        for (size_t i = 0; i < pointsPerSide; ++i) {
+            points.emplace_back(0.0, static_cast<double>(pointsPerSide - i));
+        }
+        return PolygonDouble(points);
+    }
+};
+
+TEST_F(SimplificationTest, DouglasPeuckerCollapsesCollinearEdges) {
+    PolygonDouble square = makeDenseSquare(10);
+    PolygonDouble simplified = simplify(square, 0.01, SimplificationMethod::DouglasPeucker);
+    EXPECT_EQ(simplified.vertices().size(), 4);
+    EXPECT_DOUBLE_EQ(static_cast<double>(simplified), 100.0);
+}
+
+TEST_F(SimplificationTest, VisvalingamCollapsesCollinearEdges) {
+    PolygonDouble square = makeDenseSquare(10);
+    PolygonDouble simplified = simplify(square, 0.01, SimplificationMethod::Visvalingam);
+    EXPECT_EQ(simplified.vertices().size(), 4);
+    EXPECT_DOUBLE_EQ(static_cast<double>(simplified), 100.0);
+}
+
+TEST_F(SimplificationTest, DouglasPeuckerRespectsTolerance) {
+    PolygonDouble circle = makeNoisyCircle(2000, 100.0, 0.5);
+    PolygonDouble simplified = simplify(circle, 2.0, SimplificationMethod::DouglasPeucker);
+    EXPECT_LT(simplified.vertices().size(), circle.vertices().size() / 4);
+    EXPECT_NEAR(static_cast<double>(simplified), static_cast<double>(circle), 0.03 * static_cast<double>(circle));
+}
+
+TEST_F(SimplificationTest, AreaBoundedKeepsAreaErrorWithinBudget) {
+    PolygonDouble circle = makeNoisyCircle(5000, 100.0, 1.0);
+    for (double budget : {1.0, 50.0, 500.0}) {
+        PolygonDouble simplified = simplify(circle, budget, SimplificationMethod::AreaBounded);
+        EXPECT_LE(std::abs(static_cast<double>(simplified) - static_cast<double>(circle)), budget);
+        EXPECT_LT(simplified.vertices().size(), circle.vertices().size());
+    }
+}
+
+TEST_F(SimplificationTest, ResultKeepsAtLeastThreeVertices) {
+    PolygonDouble circle = makeNoisyCircle(100, 10.0, 0.1);
+    for (auto method : {SimplificationMethod::DouglasPeucker, SimplificationMethod::Visvalingam,
+                        SimplificationMethod::AreaBounded}) {
+        PolygonDouble simplified = simplify(circle, 1e9, method);
+        EXPECT_EQ(simplified.vertices().size(), 3);
+    }
+}
+
+TEST_F(SimplificationTest, ZeroToleranceKeepsShape) {
+    PolygonDouble circle = makeNoisyCircle(500, 10.0, 0.1);
+    PolygonDouble simplified = simplify(circle, 0.0, SimplificationMethod::DouglasPeucker);
+    EXPECT_EQ(simplified.vertices().size(), circle.vertices().size());
+}
+
+TEST_F(SimplificationTest, KeepsVertexType) {
+    Polygon<int> polygon({{0, 0}, {5, 0}, {10, 0}, {10, 10}, {5, 10}, {0, 10}});
+    Polygon<int> simplified = simplify(polygon, 0.5, SimplificationMethod::Visvalingam);
+    EXPECT_EQ(simplified.vertices().size(), 4);
+    EXPECT_DOUBLE_EQ(static_cast<double>(simplified), 100.0);
+}
+
+TEST_F(SimplificationTest, NegativeToleranceThrows) {
+    PolygonDouble square = makeDenseSquare(3);
+    EXPECT_THROW(simplify(square, -1.0), std::invalid_argument);
+}
+
+TEST_F(SimplificationTest, HandlesLargeInput) {
+    PolygonDouble circle = makeNoisyCircle(200'000, 1000.0, 0.01);
+    for (auto method : {SimplificationMethod::DouglasPeucker, SimplificationMethod::Visvalingam}) {
+        PolygonDouble simplified = simplify(circle, 0.5, method);
+        EXPECT_LT(simplified.vertices().size(), circle.vertices().size());
+        EXPECT_NEAR(static_cast<double>(simplified), static_cast<double>(circle), 0.01 * static_cast<double>(circle));
+    }
+}
+
+TEST_F(SimplificationTest, BatchMatchesSingle) {
+    std::vector<PolygonDouble> polygons;
+    for (size_t i = 0; i < 200; ++i) {
+        polygons.push_back(makeNoisyCircle(50 + i, 10.0, 0.5));
+    }
+    auto simplified = simplifyAll(std::span<const PolygonDouble>(polygons), 0.3, SimplificationMethod::DouglasPeucker);
+    ASSERT_EQ(simplified.size(), polygons.size());
+    for (size_t i = 0; i < polygons.size(); ++i) {
+        auto expected = simplify(polygons[i], 0.3, SimplificationMethod::DouglasPeucker);
+        EXPECT_EQ(simplified[i].vertices().size(), expected.vertices().size());
+    }
+}
+
+TEST_F(SimplificationTest, SimplifyAllOverFigureCollections) {
+    std::vector<Rectangle<double>> rects(3, Rectangle<double>({{0, 0}, {2, 0}, {2, 1}, {0, 1}}));
+    auto simplifiedRects = simplifyAll(rects, 0.1);
+    ASSERT_EQ(simplifiedRects.size(), rects.size());
+    EXPECT_EQ(simplifiedRects[0].vertices().size(), 4u);
+    EXPECT_DOUBLE_EQ(static_cast<double>(simplifiedRects[2]), 2.0);
+
+    std::vector<std::shared_ptr<PolygonDouble>> pointers;
+    for (unsigned seed = 0; seed < 8; ++seed) {
+        pointers.push_back(std::make_shared<PolygonDouble>(makeNoisyCircle(200, 10.0, 0.05 + seed * 0.01)));
+    }
+    auto simplified = simplifyAll(pointers, 0.3, SimplificationMethod::DouglasPeucker);
+    ASSERT_EQ(simplified.size(), pointers.size());
+    for (size_t i = 0; i < pointers.size(); ++i) {
+        auto expected = simplify(*pointers[i], 0.3, SimplificationMethod::DouglasPeucker);
+        EXPECT_EQ(simplified[i].vertices().size(), expected.vertices().size());
+    }
+}
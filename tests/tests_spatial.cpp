@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+#include "Rectangle.h"
+#include "SpatialOrder.h"
+#include "Square.h"
+
+// ==================== Spatial Order Tests ====================
+
+class SpatialOrderTest : public ::testing::Test {
+protected:
+    static std::vector<Rectangle<double>> makeRectangles(size_t amount, unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<double> position(-500.0, 500.0);
+        std::vector<Rectangle<double>> rects;
+        for (size_t i = 0; i < amount; ++i) {
+            double x = position(generator);
+            double y = position(generator);
+            rects.push_back(Rectangle<double>({{x, y}, {x + 2, y}, {x + 2, y + 2}, {x, y + 2}}));
+        }
+        return rects;
+    }
+
+    static std::vector<size_t> bruteForceBox(const std::vector<Rectangle<double>>& rects, const SpatialOrder& order,
+                                             Point<double> min, Point<double> max) {
+        std::vector<size_t> positions;
+        for (size_t position = 0; position < order.order().size(); ++position) {
+            auto center = rects[order.order()[position]].calcGeometricCenter();
+            if (center.x >= min.x && center.x <= max.x && center.y >= min.y && center.y <= max.y) {
+                positions.push_back(position);
+            }
+        }
+        return positions;
+    }
+};
+
+TEST_F(SpatialOrderTest, MortonRoundTrip) {
+    std::mt19937 generator(1);
+    for (int i = 0; i < 1000; ++i) {
+        uint32_t x = generator();
+        uint32_t y = generator();
+        EXPECT_EQ(SpatialOrder::mortonPoint(SpatialOrder::mortonKey(x, y)), std::make_pair(x, y));
+    }
+    EXPECT_EQ(SpatialOrder::mortonKey(1, 0), 1);
+    EXPECT_EQ(SpatialOrder::mortonKey(0, 1), 2);
+    EXPECT_EQ(SpatialOrder::mortonKey(3, 3), 15);
+}
+
+TEST_F(SpatialOrderTest, HilbertRoundTrip) {
+    std::mt19937 generator(2);
+    for (int i = 0; i < 1000; ++i) {
+        uint32_t x = generator();
+        uint32_t y = generator();
+        EXPECT_EQ(SpatialOrder::hilbertPoint(SpatialOrder::hilbertKey(x, y)), std::make_pair(x, y));
+    }
+}
+
+TEST_F(SpatialOrderTest, HilbertStepsAreAdjacent) {
+    std::mt19937_64 generator(3);
+    for (int i = 0; i < 1000; ++i) {
+        uint64_t key = generator() - 1;
+        auto [x0, y0] = SpatialOrder::hilbertPoint(key);
+        auto [x1, y1] = SpatialOrder::hilbertPoint(key + 1);
+        int64_t distance = std::abs(int64_t(x0) - int64_t(x1)) + std::abs(int64_t(y0) - int64_t(y1));
+        EXPECT_EQ(distance, 1);
+    }
+}
+
+TEST_F(SpatialOrderTest, KeysAreSortedAndOrderIsPermutation) {
+    auto rects = makeRectangles(20000, 4);
+    for (auto curve : {SpaceFillingCurve::Morton, SpaceFillingCurve::Hilbert}) {
+        SpatialOrder order(rects, curve);
+        EXPECT_TRUE(std::is_sorted(order.keys().begin(), order.keys().end()));
+        std::vector<size_t> sorted(order.order().begin(), order.order().end());
+        std::sort(sorted.begin(), sorted.end());
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            ASSERT_EQ(sorted[i], i);
+        }
+    }
+}
+
+TEST_F(SpatialOrderTest, ApplyPermutesColumnsTogether) {
+    auto rects = makeRectangles(1000, 5);
+    std::vector<double> areas;
+    std::vector<size_t> ids;
+    for (size_t i = 0; i < rects.size(); ++i) {
+        ids.push_back(i);
+        areas.push_back(static_cast<double>(rects[i]) + static_cast<double>(i));
+    }
+    SpatialOrder order(rects);
+    auto original = rects;
+    order.apply(rects, areas, ids);
+
+    for (size_t position = 0; position < rects.size(); ++position) {
+        EXPECT_EQ(ids[position], order.order()[position]);
+        EXPECT_NEAR(areas[position], 4.0 + static_cast<double>(ids[position]), 1e-9);
+        EXPECT_DOUBLE_EQ(rects[position].calcGeometricCenter().x, original[ids[position]].calcGeometricCenter().x);
+    }
+
+    std::vector<int> wrongSize(3);
+    EXPECT_THROW(order.apply(wrongSize), std::invalid_argument);
+}
+
+TEST_F(SpatialOrderTest, ReorderedNeighboursAreCloseInMemory) {
+    auto rects = makeRectangles(50000, 6);
+    SpatialOrder order(rects, SpaceFillingCurve::Hilbert);
+    double before = 0;
+    double after = 0;
+    for (size_t position = 0; position + 1 < rects.size(); ++position) {
+        auto a = rects[position].calcGeometricCenter();
+        auto b = rects[position + 1].calcGeometricCenter();
+        before += std::hypot(a.x - b.x, a.y - b.y);
+        auto c = rects[order.order()[position]].calcGeometricCenter();
+        auto d = rects[order.order()[position + 1]].calcGeometricCenter();
+        after += std::hypot(c.x - d.x, c.y - d.y);
+    }
+    EXPECT_LT(after * 20, before);
+}
+
+TEST_F(SpatialOrderTest, QueryBoxMatchesBruteForce) {
+    auto rects = makeRectangles(20000, 7);
+    std::mt19937 generator(8);
+    std::uniform_real_distribution<double> corner(-600.0, 600.0);
+    std::uniform_real_distribution<double> size(0.5, 200.0);
+    for (auto curve : {SpaceFillingCurve::Morton, SpaceFillingCurve::Hilbert}) {
+        SpatialOrder order(rects, curve);
+        for (int query = 0; query < 50; ++query) {
+            Point<double> min(corner(generator), corner(generator));
+            Point<double> max(min.x + size(generator), min.y + size(generator));
+            EXPECT_EQ(order.queryBox(min, max), bruteForceBox(rects, order, min, max));
+        }
+    }
+}
+
+TEST_F(SpatialOrderTest, WorksOverFigurePointers) {
+    std::vector<std::shared_ptr<Figure<int>>> figures;
+    for (int i = 0; i < 10; ++i) {
+        figures.push_back(std::make_shared<Square<int>>(
+            std::initializer_list<Point<int>>{{i * 10, 0}, {i * 10 + 2, 0}, {i * 10 + 2, 2}, {i * 10, 2}}));
+    }
+    SpatialOrder order(figures, SpaceFillingCurve::Morton);
+    auto found = order.queryBox({-1.0, -1.0}, {25.0, 5.0});
+    EXPECT_EQ(found.size(), 3);
+    order.apply(figures);
+    for (size_t position : found) {
+        EXPECT_LT(figures[position]->calcGeometricCenter().x, 25);
+    }
+}
+
+TEST_F(SpatialOrderTest, EmptyCollection) {
+    std::vector<Rectangle<int>> rects;
+    SpatialOrder order(rects);
+    EXPECT_TRUE(order.keys().empty());
+    EXPECT_TRUE(order.queryBox({0.0, 0.0}, {1.0, 1.0}).empty());
+}
+
+TEST_F(SpatialOrderTest, RejectsNonFiniteCenters) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<Polygon<double>> triangles = {
+        Polygon<double>({{0, 0}, {1, 0}, {0, 1}}),
+        Polygon<double>({{5, 5}, {6, 5}, {5, 6}}),
+    };
+    SpatialOrder valid(triangles);
+    EXPECT_NE(valid.keys()[0], valid.keys()[1]);
+    EXPECT_TRUE(valid.queryBox({nan, 0.0}, {10.0, 10.0}).empty());
+
+    triangles.push_back(Polygon<double>({{nan, 2}, {3, 2}, {2, 3}}));
+    EXPECT_THROW(SpatialOrder order(triangles), std::invalid_argument);
+    triangles.back() = Polygon<double>({{inf, 2}, {3, 2}, {2, 3}});
+    EXPECT_THROW(SpatialOrder order(triangles, SpaceFillingCurve::Morton), std::invalid_argument);
+}
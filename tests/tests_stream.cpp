@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+#include <iomanip>
+#include <random>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "FigureStream.h"
+#include "Polygon.h"
+#include "Rectangle.h"
+#include "Square.h"
+#include "Trapezoid.h"
+
+// ==================== Figure Stream Tests ====================
+
+class FigureStreamTest : public ::testing::Test {};
+
+TEST_F(FigureStreamTest, ReadsRectanglesFromStream) {
+    std::istringstream iss("0 0 4 0 4 3 0 3\n0 0 2 0 2 2 0 2\n");
+    std::vector<double> areas;
+    for (auto& result : readFigures<Rectangle<int>>(iss)) {
+        ASSERT_TRUE(result.has_value());
+        areas.push_back(static_cast<double>(*result));
+    }
+    EXPECT_EQ(areas, (std::vector<double>{12.0, 4.0}));
+}
+
+TEST_F(FigureStreamTest, BadRecordsDoNotStopParsing) {
+    std::istringstream iss("0 0 4 0 4 3 0 3\n0 0 x 0 4 3 0 3\n0 0 4 0 4 3\n\n1 1 3 1 3 3 1 3");
+    std::vector<size_t> errors;
+    size_t parsed = 0;
+    for (auto& result : readFigures<Square<int>>(iss)) {
+        if (result) {
+            ++parsed;
+        } else {
+            errors.push_back(result.error().record);
+        }
+    }
+    EXPECT_EQ(parsed, 2);
+    EXPECT_EQ(errors, (std::vector<size_t>{2, 3}));
+}
+
+TEST_F(FigureStreamTest, ErrorMessages) {
+    auto figures = readFigures<Trapezoid<double>>(std::string_view("0 0 1 abc\n0 0 1\n0 0 1 0 1 1\n"));
+    std::vector<std::string> messages;
+    for (auto& result : figures) {
+        ASSERT_FALSE(result.has_value());
+        messages.push_back(result.error().message);
+    }
+    EXPECT_EQ(messages, (std::vector<std::string>{"incorrect type provided", "invalid point", "invalid amount of points"}));
+}
+
+TEST_F(FigureStreamTest, TinyChunksStitchLines) {
+    std::string text;
+    for (int i = 1; i <= 50; ++i) {
+        text += "0 0 " + std::to_string(i) + " 0 " + std::to_string(i) + " 1 0 1\n";
+    }
+    std::istringstream iss(text);
+    double total = 0;
+    size_t count = 0;
+    for (auto& result : readFigures<Rectangle<int>>(iss, 3)) {
+        ASSERT_TRUE(result.has_value());
+        total += static_cast<double>(*result);
+        ++count;
+    }
+    EXPECT_EQ(count, 50);
+    EXPECT_DOUBLE_EQ(total, 1275.0);
+}
+
+TEST_F(FigureStreamTest, GeneralPolygonTakesAnyVertexCount) {
+    std::istringstream iss("0 0 4 0 0 3\n0 0 4 0 4 4 2 6 0 4\n0 0 1 1\n");
+    std::vector<size_t> sizes;
+    size_t errors = 0;
+    for (auto& result : readFigures<Polygon<double>>(iss)) {
+        if (result) {
+            sizes.push_back(result->vertices().size());
+        } else {
+            ++errors;
+        }
+    }
+    EXPECT_EQ(sizes, (std::vector<size_t>{3, 5}));
+    EXPECT_EQ(errors, 1);
+}
+
+TEST_F(FigureStreamTest, ComposesWithRangesPipeline) {
+    std::istringstream iss("0 0 4 0 4 3 0 3\nbad\n0 0 10 0 10 10 0 10\n0 0 1 0 1 1 0 1\n");
+    auto areas = readFigures<Rectangle<double>>(iss)
+               | std::views::filter([](const auto& result) { return result.has_value(); })
+               | std::views::transform([](const auto& result) { return static_cast<double>(*result); })
+               | std::views::filter([](double area) { return area > 2.0; });
+    double total = 0;
+    for (double area : areas) {
+        total += area;
+    }
+    EXPECT_DOUBLE_EQ(total, 112.0);
+}
+
+TEST_F(FigureStreamTest, IsLazy) {
+    std::istringstream iss("0 0 4 0 4 3 0 3\n0 0 2 0 2 2 0 2\n0 0 1 0 1 1 0 1\n");
+    auto figures = readFigures<Rectangle<int>>(iss, 16);
+    auto it = figures.begin();
+    ASSERT_TRUE((*it).has_value());
+    EXPECT_DOUBLE_EQ(static_cast<double>(**it), 12.0);
+    EXPECT_FALSE(iss.eof());
+}
+
+TEST_F(FigureStreamTest, EmptyInput) {
+    std::istringstream iss("");
+    size_t count = 0;
+    for ([[maybe_unused]] auto& result : readFigures<Rectangle<int>>(iss)) {
+        ++count;
+    }
+    EXPECT_EQ(count, 0);
+}
+
+TEST_F(FigureStreamTest, AcceptsSameNumbersAsInputOperator) {
+    std::istringstream iss("+1 -2 3.5e1 4 5 6 7 8\n");
+    for (auto& result : readFigures<Rectangle<double>>(iss)) {
+        ASSERT_TRUE(result.has_value());
+        EXPECT_DOUBLE_EQ(result->vertices()[0].x, 1.0);
+        EXPECT_DOUBLE_EQ(result->vertices()[1].x, 35.0);
+    }
+
+    std::istringstream plusPoint("+.5 0 1 0 1 1 0 1\n");
+    for (auto& result : readFigures<Rectangle<double>>(plusPoint)) {
+        ASSERT_TRUE(result.has_value());
+        EXPECT_DOUBLE_EQ(result->vertices()[0].x, 0.5);
+    }
+
+    Rectangle<double> rectangle;
+    std::istringstream doubleSign("+-5 0 1 0 1 1 0 1\n");
+    EXPECT_THROW(doubleSign >> rectangle, std::invalid_argument);
+    doubleSign.clear();
+    doubleSign.seekg(0);
+    for (auto& result : readFigures<Rectangle<double>>(doubleSign)) {
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error().message, "incorrect type provided");
+    }
+}
+
+TEST_F(FigureStreamTest, RejectsNonFiniteValues) {
+    std::istringstream iss("inf 0 nan 0 1 1 0 1\n0 0 1 0 1 -inf 0 1\n0 0 1 0 1 1 0 1\n");
+    std::vector<std::string> messages;
+    size_t parsed = 0;
+    for (auto& result : readFigures<Trapezoid<double>>(iss)) {
+        if (result) {
+            ++parsed;
+        } else {
+            messages.push_back(result.error().message);
+        }
+    }
+    EXPECT_EQ(parsed, 1u);
+    EXPECT_EQ(messages, (std::vector<std::string>{"incorrect type provided", "incorrect type provided"}));
+}
+
+TEST_F(FigureStreamTest, MetricsMatchInputOperator) {
+    std::mt19937 generator(5);
+    std::uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+    std::ostringstream lines;
+    lines << std::setprecision(17);
+    for (size_t i = 0; i < 2000; ++i) {
+        for (size_t k = 0; k < 8; ++k) {
+            lines << coordinate(generator) << (k == 7 ? '\n' : ' ');
+        }
+    }
+
+    std::string text = lines.str();
+    std::istringstream reference(text);
+    for (auto& result : readFigures<Trapezoid<double>>(std::string_view(text))) {
+        ASSERT_TRUE(result.has_value());
+        Trapezoid<double> expected;
+        reference >> expected;
+        EXPECT_EQ(static_cast<double>(*result), static_cast<double>(expected));
+        EXPECT_EQ(result->calcGeometricCenter().x, expected.calcGeometricCenter().x);
+        EXPECT_EQ(result->calcGeometricCenter().y, expected.calcGeometricCenter().y);
+    }
+}
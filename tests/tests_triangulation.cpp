@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <vector>
+#include "Polygon.h"
+#include "PolygonTriangulation.h"
+#include "Rectangle.h"
+#include "Trapezoid.h"
+
+// ==================== Triangulation Tests ====================
+
+class TriangulationTest : public ::testing::Test {
+protected:
+    static std::vector<Point<double>> makeStar(size_t amountOfVertices, unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<double> radius(1.0, 10.0);
+        std::vector<Point<double>> points;
+        for (size_t i = 0; i < amountOfVertices; ++i) {
+            double angle = 2 * std::numbers::pi * static_cast<double>(i) / static_cast<double>(amountOfVertices);
+            double r = radius(generator);
+            points.emplace_back(r * std::cos(angle), r * std::sin(angle));
+        }
+        return points;
+    }
+
+    // Rectilinear comb: many horizontal edges and vertices sharing a y coordinate.
+    static std::vector<Point<int>> makeComb(int teeth) {
+        std::vector<Point<int>> points = {{0, 0}, {2 * teeth, 0}};
+        for (int i = teeth - 1; i >= 0; --i) {
+            points.emplace_back(2 * i + 2, 5);
+            points.emplace_back(2 * i + 1, 5);
+            points.emplace_back(2 * i + 1, 1);
+            points.emplace_back(2 * i, 1);
+        }
+        points.back() = {0, 5};
+        return points;
+    }
+
+    template <Scalar T>
+    static double polygonArea(const std::vector<Point<T>>& points) {
+        double area = 0;
+        for (size_t i = 0; i < points.size(); ++i) {
+            size_t j = (i + 1) % points.size();
+            area += static_cast<double>(points[i].x) * points[j].y - static_cast<double>(points[j].x) * points[i].y;
+        }
+        return std::abs(area) / 2;
+    }
+
+    template <Scalar T>
+    static bool contains(const std::vector<Point<T>>& points, double x, double y) {
+        bool inside = false;
+        for (size_t i = 0, j = points.size() - 1; i < points.size(); j = i++) {
+            double xi = points[i].x, yi = points[i].y, xj = points[j].x, yj = points[j].y;
+            if ((yi > y) != (yj > y) && x < (xj - xi) * (y - yi) / (yj - yi) + xi) {
+                inside = !inside;
+            }
+        }
+        return inside;
+    }
+
+    template <Scalar T>
+    static void expectValidTriangulation(const std::vector<Point<T>>& points, const std::vector<uint32_t>& indices,
+                                         size_t triangles) {
+        ASSERT_EQ(triangles, points.size() - 2);
+        double area = 0;
+        for (size_t t = 0; t < triangles; ++t) {
+            const auto& a = points.at(indices[3 * t]);
+            const auto& b = points.at(indices[3 * t + 1]);
+            const auto& c = points.at(indices[3 * t + 2]);
+            double doubled = (static_cast<double>(b.x) - a.x) * (static_cast<double>(c.y) - a.y)
+                           - (static_cast<double>(c.x) - a.x) * (static_cast<double>(b.y) - a.y);
+            ASSERT_GE(doubled, 0.0) << "triangle " << t << " is clockwise";
+            area += doubled / 2;
+            if (doubled > 1e-9) {
+                double cx = (static_cast<double>(a.x) + b.x + c.x) / 3;
+                double cy = (static_cast<double>(a.y) + b.y + c.y) / 3;
+                ASSERT_TRUE(contains(points, cx, cy)) << "triangle " << t << " lies outside";
+            }
+        }
+        EXPECT_NEAR(area, polygonArea(points), 1e-9 * std::max(1.0, polygonArea(points)));
+    }
+};
+
+TEST_F(TriangulationTest, IndexCount) {
+    EXPECT_EQ(Triangulator<int>::indexCount(2), 0);
+    EXPECT_EQ(Triangulator<int>::indexCount(3), 3);
+    EXPECT_EQ(Triangulator<int>::indexCount(10), 24);
+}
+
+TEST_F(TriangulationTest, Rectangle) {
+    Rectangle<int> rect({{0, 0}, {4, 0}, {4, 3}, {0, 3}});
+    std::vector<uint32_t> indices(Triangulator<int>::indexCount(4));
+    Triangulator<int> triangulator;
+    size_t triangles = triangulator.triangulate(rect, indices);
+    std::vector<Point<int>> points(rect.vertices().begin(), rect.vertices().end());
+    expectValidTriangulation(points, indices, triangles);
+}
+
+TEST_F(TriangulationTest, ConcaveQuad) {
+    std::vector<Point<int>> points = {{0, 0}, {4, 0}, {1, 1}, {0, 4}};
+    std::vector<uint32_t> indices(6);
+    Triangulator<int> triangulator;
+    expectValidTriangulation(points, indices, triangulator.triangulate(points, indices));
+}
+
+TEST_F(TriangulationTest, RandomStars) {
+    Triangulator<double> triangulator;
+    std::vector<uint32_t> indices;
+    for (unsigned seed = 0; seed < 50; ++seed) {
+        auto points = makeStar(5 + seed * 7, seed);
+        indices.resize(Triangulator<double>::indexCount(points.size()));
+        expectValidTriangulation(points, indices, triangulator.triangulate(points, indices));
+    }
+}
+
+TEST_F(TriangulationTest, ClockwiseInput) {
+    auto points = makeStar(40, 123);
+    std::reverse(points.begin(), points.end());
+    std::vector<uint32_t> indices(Triangulator<double>::indexCount(points.size()));
+    Triangulator<double> triangulator;
+    expectValidTriangulation(points, indices, triangulator.triangulate(points, indices));
+}
+
+TEST_F(TriangulationTest, CombWithHorizontalEdges) {
+    Triangulator<int> triangulator;
+    for (int teeth : {1, 2, 5, 50}) {
+        auto points = makeComb(teeth);
+        std::vector<uint32_t> indices(Triangulator<int>::indexCount(points.size()));
+        expectValidTriangulation(points, indices, triangulator.triangulate(points, indices));
+
+        std::reverse(points.begin(), points.end());
+        expectValidTriangulation(points, indices, triangulator.triangulate(points, indices));
+    }
+}
+
+TEST_F(TriangulationTest, LargeStar) {
+    auto points = makeStar(100000, 77);
+    std::vector<uint32_t> indices(Triangulator<double>::indexCount(points.size()));
+    Triangulator<double> triangulator;
+    size_t triangles = triangulator.triangulate(points, indices);
+    ASSERT_EQ(triangles, points.size() - 2);
+
+    double area = 0;
+    for (size_t t = 0; t < triangles; ++t) {
+        const auto& a = points[indices[3 * t]];
+        const auto& b = points[indices[3 * t + 1]];
+        const auto& c = points[indices[3 * t + 2]];
+        area += ((b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y)) / 2;
+    }
+    EXPECT_NEAR(area, polygonArea(points), 1e-6 * polygonArea(points));
+}
+
+TEST_F(TriangulationTest, BufferTooSmallThrows) {
+    auto points = makeStar(10, 1);
+    std::vector<uint32_t> indices(5);
+    Triangulator<double> triangulator;
+    EXPECT_THROW(triangulator.triangulate(points, indices), std::invalid_argument);
+}
+
+TEST_F(TriangulationTest, BatchOffsetsIndices) {
+    std::vector<Trapezoid<int>> figures = {
+        Trapezoid<int>({{0, 0}, {4, 0}, {3, 2}, {1, 2}}),
+        Trapezoid<int>({{10, 0}, {16, 0}, {15, 3}, {11, 3}}),
+        Trapezoid<int>({{0, 10}, {1, 12}, {3, 12}, {4, 10}}),
+    };
+    std::vector<uint32_t> indices(3 * Triangulator<int>::indexCount(4));
+    std::vector<uint32_t> firstTriangles(figures.size() + 1);
+    Triangulator<int> triangulator;
+    size_t triangles = triangulator.triangulateAll(figures, indices, firstTriangles);
+
+    EXPECT_EQ(triangles, 6);
+    EXPECT_EQ(firstTriangles, (std::vector<uint32_t>{0, 2, 4, 6}));
+    std::vector<Point<int>> concatenated;
+    for (const auto& figure : figures) {
+        concatenated.insert(concatenated.end(), figure.vertices().begin(), figure.vertices().end());
+    }
+    double area = 0;
+    for (size_t t = 0; t < triangles; ++t) {
+        for (size_t k = 0; k < 3; ++k) {
+            size_t figure = indices[3 * t + k] / 4;
+            EXPECT_EQ(figure, t / 2);
+        }
+        const auto& a = concatenated[indices[3 * t]];
+        const auto& b = concatenated[indices[3 * t + 1]];
+        const auto& c = concatenated[indices[3 * t + 2]];
+        area += ((b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y)) / 2.0;
+    }
+    EXPECT_DOUBLE_EQ(area, static_cast<double>(figures[0]) + static_cast<double>(figures[1]) + static_cast<double>(figures[2]));
+}
+
+TEST_F(TriangulationTest, BatchOverFigurePointers) {
+    std::vector<std::unique_ptr<Rectangle<double>>> figures;
+    figures.push_back(std::make_unique<Rectangle<double>>(std::initializer_list<Point<double>>{{0, 0}, {2, 0}, {2, 1}, {0, 1}}));
+    figures.push_back(std::make_unique<Rectangle<double>>(std::initializer_list<Point<double>>{{5, 5}, {6, 5}, {6, 8}, {5, 8}}));
+    std::vector<uint32_t> indices(2 * Triangulator<double>::indexCount(4));
+    Triangulator<double> triangulator;
+    EXPECT_EQ(triangulator.triangulateAll(figures, indices), 4);
+    for (size_t i = 6; i < indices.size(); ++i) {
+        EXPECT_GE(indices[i], 4u);
+    }
+}